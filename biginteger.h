@@ -1,6 +1,23 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cmath>
 #include <compare>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <chrono>
 
@@ -11,627 +28,4921 @@ enum class Sign{
 };
 
 
-class BigInteger {
-private:
-    static const int base_ = 1e9;
-    static const int nine_ = 9;
-    Sign sign_;
-    std::vector<int> arr_;
+struct BigIntegerThresholds {
+    static inline size_t karatsuba = 48;
+    static inline size_t toom3 = 150;
+    static inline size_t ntt = 800;
+    static inline size_t burnikel_ziegler = 60;
+    static inline size_t divide_exact = 300;
+    static inline size_t newton = 20000;
+    static inline size_t radix_conversion = 30;
+    static inline size_t parallel_chunk = 1 << 14;
+};
 
-    friend std::istream& operator>>(std::istream& in, BigInteger& number);
-    friend std::ostream& operator<<(std::ostream& out, const BigInteger& number);
-    friend BigInteger& operator/=(BigInteger& first, const BigInteger& second);
-    friend BigInteger gcd(BigInteger first, BigInteger second);
-    int bin_search(const BigInteger& second);
-    friend class Rational;
 
-    void clear_zero(){
-        while (arr_.back() == 0 && arr_.size() > 1) {
-            arr_.pop_back();
+class BigIntegerThreadPool {
+private:
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+
+    static inline std::unique_ptr<BigIntegerThreadPool> instance_;
+
+    struct Loop {
+        std::function<void(size_t)> body;
+        size_t count;
+        std::atomic<size_t> next = 0;
+        std::atomic<size_t> done = 0;
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+
+    static void run_loop(const std::shared_ptr<Loop>& loop) {
+        for (size_t i = loop->next++; i < loop->count; i = loop->next++) {
+            loop->body(i);
+
+            if (++loop->done == loop->count) {
+                std::lock_guard<std::mutex> lock(loop->mutex);
+                loop->finished.notify_all();
+            }
         }
     }
 
-public:
+    void work() {
+        while (true) {
+            std::function<void()> task;
 
-    BigInteger() = default;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
 
-    explicit BigInteger(long long unsigned number) : sign_(Sign::positive) {
-        while (number>=base_){
-            arr_.push_back(number%base_);
-            number/=base_;
-        }
-        if (number!=0){
-            arr_.push_back(number);
-        }
+                if (tasks_.empty()) {
+                    return;
+                }
+
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
 
+            task();
+        }
     }
 
-    BigInteger(int integer) : sign_((integer >= 0 ? Sign::positive : Sign::negative)) {
+public:
 
-        if (!static_cast<bool>(sign_)) {
-            integer *= -1;
+    explicit BigIntegerThreadPool(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            workers_.emplace_back([this] { work(); });
         }
+    }
 
-        while (integer >= base_) {
-            arr_.push_back(integer%base_);
-            integer/=base_;
+    BigIntegerThreadPool(const BigIntegerThreadPool&) = delete;
+    BigIntegerThreadPool& operator=(const BigIntegerThreadPool&) = delete;
+
+    ~BigIntegerThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
         }
 
-       if (integer!=0||arr_.empty()){
-           arr_.push_back(integer);
-       }
+        condition_.notify_all();
 
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
     }
 
-    BigInteger& operator+=(const BigInteger& other) {
-        size_t end;
-        if (arr_.size() < other.arr_.size()) {
-            arr_.resize(other.arr_.size());
-            end = arr_.size();
-        }
+    static void set_thread_count(size_t count) {
+        instance_.reset();
 
-        else {
-            end = other.arr_.size();
+        if (count > 1) {
+            instance_ = std::make_unique<BigIntegerThreadPool>(count - 1);
         }
+    }
+
+    static size_t thread_count() {
+        return instance_ ? instance_->workers_.size() + 1 : 1;
+    }
 
-        if (sign_ == other.sign_) {
+    template <typename Function>
+    static void parallel_for(size_t count, Function body) {
+        if (!instance_ || count < 2) {
 
-            for (size_t i = 0; i < end; ++i) {
-                arr_[i] += other.arr_[i];
+            for (size_t i = 0; i < count; ++i) {
+                body(i);
             }
 
-            for (size_t i = 0; i < arr_.size() - 1; ++i) {
+            return;
+        }
 
-                if (arr_[i] >= base_) {
-                    ++arr_[i + 1];
-                    arr_[i] %= base_;
-                }
+        auto loop = std::make_shared<Loop>();
+        loop->body = body;
+        loop->count = count;
 
-            }
+        {
+            std::lock_guard<std::mutex> lock(instance_->mutex_);
 
-            if (arr_[arr_.size() - 1] >= base_) {
-                arr_[arr_.size() - 1] %= base_;
-                arr_.push_back(1);
+            for (size_t i = 1; i < std::min(count, thread_count()); ++i) {
+                instance_->tasks_.emplace_back([loop] { run_loop(loop); });
             }
-
         }
 
-        else {
+        instance_->condition_.notify_all();
+        run_loop(loop);
+        std::unique_lock<std::mutex> lock(loop->mutex);
+        loop->finished.wait(lock, [&loop] { return loop->done == loop->count; });
+    }
 
-            for (size_t i = 0; i < end; ++i) {
-                arr_[i] -= other.arr_[i];
-            }
+    template <typename Function>
+    static void parallel_chunks(size_t size, Function body) {
+        size_t chunks = std::min(4 * thread_count(), size / std::max<size_t>(BigIntegerThresholds::parallel_chunk, 1));
 
-            for (size_t i = 0; i < arr_.size() - 1; ++i) {
+        if (chunks < 2) {
+            body(0, size);
+            return;
+        }
 
-                if (arr_[i] < 0) {
-                    arr_[i] += base_;
-                    --arr_[i + 1];
-                }
+        parallel_for(chunks, [&](size_t chunk) {
+            body(size * chunk / chunks, size * (chunk + 1) / chunks);
+        });
+    }
+};
 
-            }
 
-        }
-        int index = arr_.size() - 1;
+template <typename T, size_t N, typename Alloc = std::allocator<T>>
+class SmallVector {
+private:
+    using allocator_traits = std::allocator_traits<Alloc>;
 
-        if (arr_[index] < 0) {
+    [[no_unique_address]] Alloc alloc_;
+    T* data_ = buffer_;
+    size_t size_ = 0;
+    size_t capacity_ = N;
+    T buffer_[N] = {};
 
-            sign_ = static_cast<bool>(sign_) ? Sign::negative : Sign::positive;
-            arr_[index] *= -1;
+    constexpr void release() {
+        if (data_ != buffer_) {
+            allocator_traits::deallocate(alloc_, data_, capacity_);
+        }
 
-            for (int i = index - 1; i >= 0; --i) {
+        data_ = buffer_;
+        capacity_ = N;
+    }
 
-                if (arr_[i] != 0) {
-                    --arr_[i + 1];
-                    arr_[i] -= base_;
-                    arr_[i] *= -1;
-                }
+public:
 
-            }
+    constexpr SmallVector() = default;
 
-        }
-        clear_zero();
-        if (arr_[arr_.size() - 1] == 0) {
-            sign_ = Sign::positive;
-        }
-        return *this;
-    }
+    constexpr explicit SmallVector(const Alloc& alloc) : alloc_(alloc) {}
 
-    BigInteger& operator-=(const BigInteger& other) {
-        sign_ = (static_cast<bool>(sign_)) ? Sign::negative : Sign::positive;
-        *this+=other;
-        sign_ = (static_cast<bool>(sign_)&&arr_[arr_.size()-1]!=0) ? Sign::negative : Sign::positive;
-        return *this;
+    constexpr explicit SmallVector(size_t size, const T& value = T(), const Alloc& alloc = Alloc()) : alloc_(alloc) {
+        assign(size, value);
     }
 
-    BigInteger& operator*=(const BigInteger& other) {
+    constexpr SmallVector(const SmallVector& other)
+            : alloc_(allocator_traits::select_on_container_copy_construction(other.alloc_)) {
+        assign(other.begin(), other.end());
+    }
 
-        sign_ = (static_cast<bool>(sign_) == static_cast<bool>(other.sign_)) ? Sign::positive : Sign::negative;
-        long long number = 1;
-        std::vector<long long> new_arr(arr_.size() + other.arr_.size() + 1);
+    constexpr SmallVector(SmallVector&& other) noexcept : alloc_(other.alloc_) {
+        *this = std::move(other);
+    }
 
-        for (size_t i = 0; i < arr_.size(); ++i) {
+    constexpr SmallVector& operator=(const SmallVector& other) {
+        if (this == &other) {
+            return *this;
+        }
 
-            for (size_t j = 0; j < other.arr_.size(); ++j) {
-                number = arr_[i];
-                number *= other.arr_[j];
-                new_arr[i + j] += (number % base_);
-                new_arr[i + j + 1] += (number / base_);
-                number = 1;
+        if constexpr (allocator_traits::propagate_on_container_copy_assignment::value) {
+            if (!(alloc_ == other.alloc_)) {
+                release();
             }
 
+            alloc_ = other.alloc_;
         }
 
-        arr_.resize(new_arr.size());
-
-        for (size_t i = 0; i < arr_.size(); ++i) {
+        assign(other.begin(), other.end());
+        return *this;
+    }
 
-            if (new_arr[i] >= base_) {
-                new_arr[i + 1] += new_arr[i] / base_;
-                arr_[i] = (new_arr[i] % base_);
-            }
+    constexpr SmallVector& operator=(SmallVector&& other) {
+        if (this == &other) {
+            return *this;
+        }
 
-            else {
-                arr_[i] = new_arr[i];
+        if constexpr (allocator_traits::propagate_on_container_move_assignment::value) {
+            if (!(alloc_ == other.alloc_)) {
+                release();
             }
 
+            alloc_ = other.alloc_;
         }
 
-        clear_zero();
+        if (other.data_ == other.buffer_ || !(alloc_ == other.alloc_)) {
+            assign(other.begin(), other.end());
+        }
 
-        if (arr_[arr_.size() - 1] == 0) {
-            sign_ = Sign::positive;
+        else {
+            release();
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.buffer_;
+            other.capacity_ = N;
         }
 
+        other.size_ = 0;
         return *this;
     }
 
-    BigInteger operator-() const {
-        BigInteger result = *this;
+    constexpr Alloc get_allocator() const { return alloc_; }
 
-        if (result == 0) {
-            result.sign_ = Sign::positive;
+    constexpr void reserve(size_t capacity) {
+        if (capacity <= capacity_) {
+            return;
         }
 
-        else {
-            result.sign_ = sign_==Sign::positive ? Sign::negative : Sign::positive;;
+        T* data = allocator_traits::allocate(alloc_, capacity);
+
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < capacity; ++i) {
+                std::construct_at(data + i);
+            }
         }
 
-        return result;
+        std::copy(data_, data_ + size_, data);
+        release();
+        data_ = data;
+        capacity_ = capacity;
     }
 
-    BigInteger& operator++() {
-        *this += 1;
-        return *this;
-    }
+    constexpr void resize(size_t size, const T& value = T()) {
+        if (size > capacity_) {
+            reserve(std::max(size, 2 * capacity_));
+        }
 
-    BigInteger operator++(int) {
-        BigInteger result = *this;
-        ++(*this);
-        return result;
-    }
+        if (size > size_) {
+            std::fill(data_ + size_, data_ + size, value);
+        }
 
-    BigInteger& operator--() {
-        *this -= 1;
-        return *this;
+        size_ = size;
     }
 
-    BigInteger operator--(int) {
-        BigInteger result = *this;
-        --(*this);
-        return result;
+    constexpr void assign(size_t size, const T& value) {
+        size_ = 0;
+        resize(size, value);
     }
 
-    explicit operator bool() const { return (arr_[arr_.size() - 1] != 0); }
+    template <typename Iterator>
+    constexpr void assign(Iterator first, Iterator last) {
+        size_ = 0;
+        reserve(last - first);
+        std::copy(first, last, data_);
+        size_ = last - first;
+    }
 
-    std::string toString() const {
-        std::string str;
+    constexpr T* insert(T* position, size_t count, const T& value) {
+        size_t index = position - data_;
+        resize(size_ + count);
+        std::copy_backward(data_ + index, data_ + size_ - count, data_ + size_);
+        std::fill(data_ + index, data_ + index + count, value);
+        return data_ + index;
+    }
 
-        if (!static_cast<bool>(sign_)) {
-            str += "-";
+    constexpr void push_back(const T& value) {
+        if (size_ == capacity_) {
+            reserve(2 * capacity_);
         }
 
-        str += std::to_string(arr_[arr_.size() - 1]);
-        int st = arr_.size() - 2;
+        data_[size_++] = value;
+    }
 
-        for (int i = st; i >= 0; --i) {
-            std::string arr_i = std::to_string(arr_[i]);
-            int count_of_null = nine_ - arr_i.size();
-            str += std::string(count_of_null, '0');
-            str += arr_i;
-        }
+    constexpr void pop_back() { --size_; }
 
-        return str;
-    }
+    constexpr void clear() { size_ = 0; }
 
-    std::weak_ordering operator<=>(const BigInteger& other) const {
-        if (sign_!=other.sign_){
-            return (sign_ <=> other.sign_);
-        }
+    constexpr size_t size() const { return size_; }
 
-        if (arr_.size() != other.arr_.size()) {
+    constexpr size_t capacity() const { return capacity_; }
 
-            return (static_cast<bool>(sign_)) ? arr_.size() <=> other.arr_.size() : other.arr_.size() <=> arr_.size();
+    constexpr bool empty() const { return size_ == 0; }
 
-        }
+    constexpr T* data() { return data_; }
 
-        for (int i = arr_.size() - 1; i >= 0; --i) {
+    constexpr const T* data() const { return data_; }
 
-            if (arr_[i] != other.arr_[i]) {
+    constexpr T* begin() { return data_; }
 
-                return (static_cast<bool>(sign_)) ? arr_[i] <=> other.arr_[i] : other.arr_[i] <=> arr_[i];
+    constexpr const T* begin() const { return data_; }
 
-            }
+    constexpr T* end() { return data_ + size_; }
 
-        }
-        return std::weak_ordering::equivalent;
+    constexpr const T* end() const { return data_ + size_; }
 
-    }
-    bool operator==(const BigInteger& second) const {
-        if (sign_ == second.sign_ && arr_.size() == second.arr_.size()) {
-            int sz = arr_.size();
+    constexpr T& back() { return data_[size_ - 1]; }
 
-            for (int i = sz - 1; i >= 0; --i) {
+    constexpr const T& back() const { return data_[size_ - 1]; }
 
-                if (arr_[i] != second.arr_[i]) {
-                    return false;
-                }
+    constexpr T& operator[](size_t index) { return data_[index]; }
 
-            }
+    constexpr const T& operator[](size_t index) const { return data_[index]; }
 
-            return true;
-        }
-        return false;
+    constexpr ~SmallVector() {
+        release();
     }
-
-    ~BigInteger() = default;
 };
 
-BigInteger operator""_bi(long long unsigned number) {
-    return number;
-}
-
-BigInteger operator*(const BigInteger& first, const BigInteger& second) {
-    BigInteger new_first = first;
-    new_first *= second;
-    return new_first;
-}
 
-std::ostream& operator<<(std::ostream& out, const BigInteger& number) {
-    std::string str = number.toString();
-    out << str;
-    return out;
-}
+template <typename Alloc = std::allocator<int>>
+class BasicBigInteger;
 
-std::istream& operator>>(std::istream& in, BigInteger& number) {
-    number.arr_.clear();
-    std::string str;
-    in >> str;
-    if (str[0] != '-') {
-        number.sign_ = Sign::positive;
-    } else {
-        number.sign_ = Sign::negative;
-    }
-    std::string s;
-    int sz = str.size();
-    int end = (static_cast<bool>(number.sign_)) ? 0 : 1;
+using BigInteger = BasicBigInteger<>;
 
-    for (int i = sz - 1; i >= end; i--) {
 
-        if (s.size() < BigInteger::nine_) {
-            s += str[i];
-        }
+template <typename Alloc>
+class BasicBigInteger {
+private:
+    static constexpr int base_ = 1e9;
+    static constexpr int nine_ = 9;
+    static constexpr size_t inline_limbs_ = 5;
+    using storage = SmallVector<int, inline_limbs_, Alloc>;
+    using buffer = std::vector<int, Alloc>;
+    using ntt_buffer = std::vector<unsigned, typename std::allocator_traits<Alloc>::template rebind_alloc<unsigned>>;
+    Sign sign_;
+    storage arr_;
+
+    template <typename A>
+    friend std::istream& operator>>(std::istream& in, BasicBigInteger<A>& number);
+    template <typename A>
+    friend std::ostream& operator<<(std::ostream& out, const BasicBigInteger<A>& number);
+    template <typename A>
+    friend std::to_chars_result to_chars(char* first, char* last, const BasicBigInteger<A>& number);
+    template <typename A>
+    friend std::from_chars_result from_chars(const char* first, const char* last, BasicBigInteger<A>& number);
+    template <typename A>
+    friend BasicBigInteger<A>& operator/=(BasicBigInteger<A>& first, const BasicBigInteger<A>& second);
+    template <typename A>
+    friend BasicBigInteger<A>& operator%=(BasicBigInteger<A>& first, const BasicBigInteger<A>& second);
+    template <typename A>
+    friend BasicBigInteger<A>& operator/=(BasicBigInteger<A>& first, long long second);
+    template <typename A>
+    friend BasicBigInteger<A>& operator%=(BasicBigInteger<A>& first, long long second);
+    template <typename A>
+    friend BasicBigInteger<A>& addmul(BasicBigInteger<A>& result, const BasicBigInteger<A>& first,
+                                      const BasicBigInteger<A>& second);
+    template <typename A>
+    friend BasicBigInteger<A>& submul(BasicBigInteger<A>& result, const BasicBigInteger<A>& first,
+                                      const BasicBigInteger<A>& second);
+    template <typename A>
+    friend BasicBigInteger<A>& divexact(BasicBigInteger<A>& first, const BasicBigInteger<A>& second);
+    template <typename A>
+    friend BasicBigInteger<A> multiply_ntt(const BasicBigInteger<A>& first, const BasicBigInteger<A>& second);
+    friend BigInteger gcd(BigInteger first, BigInteger second);
+    friend size_t exponent_words(BigInteger exponent, std::vector<unsigned>& words);
+    friend bool is_probable_prime(const BigInteger& number, int rounds);
+    friend BigInteger next_prime(const BigInteger& number);
+    friend BigInteger iroot(const BigInteger& number, int degree);
+    friend bool is_perfect_square(const BigInteger& number);
+    template <typename Engine>
+    friend BigInteger random_below(const BigInteger& bound, Engine& engine);
+    friend BigInteger extended_gcd(const BigInteger& first, const BigInteger& second, BigInteger& x, BigInteger& y);
+    friend class Rational;
+    friend class MontgomeryContext;
+    template <size_t Bits, bool Signed>
+    friend class BasicFixedInt;
+    template <size_t Limbs>
+    friend class StaticBigInteger;
 
-        else {
-            reverse(s.begin(), s.end());
-            number.arr_.push_back(std::stoi(s));
-            s = str[i];
+    constexpr void clear_zero(){
+        while (arr_.back() == 0 && arr_.size() > 1) {
+            arr_.pop_back();
         }
-
     }
 
-    if (!s.empty()) {
-        reverse(s.begin(), s.end());
-        number.arr_.push_back(std::stoi(s));
-    }
-    return in;
-}
+    static constexpr void mul_basecase(const int* first, size_t first_size, const int* second, size_t second_size,
+                                       int* result) {
+        std::fill(result, result + first_size + second_size, 0);
 
-BigInteger operator+(const BigInteger& first, const BigInteger& second) {
-    BigInteger result = first;
-    result += second;
-    return result;
-}
+        for (size_t i = 0; i < first_size; ++i) {
 
-int BigInteger::bin_search(const BigInteger& second) {
-    int st = -1;
-    int end = BigInteger::base_;
-    int middle;
-    BigInteger mult;
+            if (first[i] == 0) {
+                continue;
+            }
 
-    while ((end - st) > 1) {
-        middle = (st + end) / 2;
-        mult = second;
-        mult *= middle;
-        if (mult > *this) {
-            end = middle;
-        }
+            unsigned long long carry = 0;
 
-        else {
-            st = middle;
+            for (size_t j = 0; j < second_size; ++j) {
+                unsigned long long number = result[i + j];
+                number += static_cast<unsigned long long>(first[i]) * second[j] + carry;
+                result[i + j] = number % base_;
+                carry = number / base_;
+            }
+
+            result[i + second_size] = carry;
         }
     }
 
-    return st;
-}
-BigInteger& operator/=(BigInteger& first, const BigInteger& second) {
-    int index = first.arr_.size() - 1;
-    int search_index;
-    BigInteger temp = first.arr_[index];
-    BigInteger answ = 0;
-    BigInteger second_change = second;
-    second_change.sign_ = Sign::positive;
+    static constexpr void add_limbs(int* first, size_t first_size, const int* second, size_t second_size) {
+        while (second_size > 0 && second[second_size - 1] == 0) {
+            --second_size;
+        }
 
-    while (index >= 0) {
-        search_index = temp.bin_search(second_change);
-        answ += search_index;
-        temp -= search_index * second_change;
+        int carry = 0;
 
-        if (index > 0) {
-            --index;
-            answ *= BigInteger::base_;
-            temp *= BigInteger::base_;
-            temp += first.arr_[index];
-        }
+        for (size_t i = 0; i < first_size && (i < second_size || carry != 0); ++i) {
+            first[i] += (i < second_size ? second[i] : 0) + carry;
+            carry = first[i] >= base_ ? 1 : 0;
 
-        else {
-            --index;
+            if (carry != 0) {
+                first[i] -= base_;
+            }
         }
     }
-    if (answ == 0) {
-        first = answ;
-        first.sign_ = Sign::positive;
-    }
 
-    else {
-        answ.sign_ = (static_cast<bool>(first.sign_) == static_cast<bool>(second.sign_)) ? Sign::positive : Sign::negative;
-        first = answ;
-    }
+    static constexpr void submul_limbs(int* first, size_t first_size, const int* second, size_t second_size,
+                                       int factor) {
+        long long borrow = 0;
 
-    return first;
-}
+        for (size_t i = 0; i < first_size && (i < second_size || borrow != 0); ++i) {
+            long long number = first[i] - borrow;
 
-BigInteger operator/(const BigInteger& first, const BigInteger& second) {
-    BigInteger temp = first;
-    temp /= second;
-    return temp;
-}
+            if (i < second_size) {
+                number -= static_cast<long long>(factor) * second[i];
+            }
 
-BigInteger& operator%=(BigInteger& first, const BigInteger& second) {
-    first -= (first / second) * second;
-    return first;
-}
+            borrow = 0;
 
-BigInteger gcd(BigInteger first, BigInteger second) {
-    first.sign_ = Sign::positive;
-    second.sign_ = Sign::positive;
+            if (number < 0) {
+                borrow = (base_ - 1 - number) / base_;
+                number += borrow * base_;
+            }
 
-    while (second) {
-        first %= second;
-        std::swap(first, second);
+            first[i] = number;
+        }
     }
 
-    if (!static_cast<bool>(first.sign_)) {
-        first.sign_ = Sign::positive;
-    }
+    static int addmul_limbs(int* result, size_t result_size, const int* first, size_t first_size,
+                            const int* second, size_t second_size, bool subtract) {
+        static const unsigned long long offset = static_cast<unsigned long long>(base_) * base_;
+        int overflow = 0;
 
-    return first;
-}
+        for (size_t i = 0; i < first_size; ++i) {
 
-BigInteger operator-(const BigInteger& first, const BigInteger& second) {
-    BigInteger result = first;
-    result -= second;
-    return result;
-}
+            if (first[i] == 0) {
+                continue;
+            }
 
-BigInteger operator%(const BigInteger& first, const BigInteger& second) {
-    BigInteger result = first;
-    result %= second;
-    return result;
-}
+            unsigned long long factor = first[i];
+            unsigned long long carry = 0;
 
-class Rational {
+            if (subtract) {
 
-private:
-    static const int decimal_const = 15;
-    BigInteger dividend;
-    BigInteger divisor;
+                for (size_t j = 0; j < second_size; ++j) {
+                    unsigned long long number = result[i + j] + offset - carry;
+                    number -= factor * second[j];
+                    result[i + j] = number % base_;
+                    carry = base_ - number / base_;
+                }
 
-public:
+            }
 
-    Rational() = default;
+            else {
 
-    Rational(const BigInteger& first, const BigInteger& second) {
-        dividend = first;
-        divisor = second;
+                for (size_t j = 0; j < second_size; ++j) {
+                    unsigned long long number = result[i + j];
+                    number += factor * second[j] + carry;
+                    result[i + j] = number % base_;
+                    carry = number / base_;
+                }
 
-        if (!static_cast<bool>(divisor.sign_)) {
-            divisor.sign_ = (static_cast<bool>(divisor.sign_)) ? Sign::negative : Sign::positive;
-            dividend.sign_ = (static_cast<bool>(dividend.sign_)) ? Sign::negative : Sign::positive;
-        }
+            }
 
-        BigInteger nod = gcd(first, second);
-        divisor /= nod;
-        dividend /= nod;
-    }
+            for (size_t k = i + second_size; k < result_size && carry != 0; ++k) {
+                long long number = subtract ? result[k] - static_cast<long long>(carry) : result[k] + carry;
+                carry = 0;
 
-    Rational(const BigInteger& number) {
-        dividend = number;
-        divisor = 1;
-    }
+                if (number < 0) {
+                    number += base_;
+                    carry = 1;
+                }
 
-    Rational(int number) {
-        dividend = number;
-        divisor = 1;
-    }
+                else if (number >= base_) {
+                    number -= base_;
+                    carry = 1;
+                }
 
-    Rational& operator+=(const Rational& other) {
-        dividend *= other.divisor;
-        dividend += (other.dividend * divisor);
-        divisor *= other.divisor;
-        BigInteger nod = gcd(dividend, divisor);
-        divisor /= nod;
-        dividend /= nod;
-        return *this;
-    }
+                result[k] = number;
+            }
 
-    Rational& operator-=(const Rational& other) {
-        this->dividend.sign_ = (static_cast<bool>(this->dividend.sign_)) ? Sign::negative : Sign::positive;
-        *this+=other;
-        this->dividend.sign_ = (static_cast<bool>(this->dividend.sign_)) ? Sign::negative : Sign::positive;
-        return *this;
-    }
+            overflow += carry;
+        }
 
-    Rational& operator*=(const Rational& other) {
-        dividend *= other.dividend;
-        divisor *= other.divisor;
-        BigInteger nod = gcd(dividend, divisor);
-        divisor /= nod;
-        dividend /= nod;
-        return *this;
+        return overflow;
     }
 
-    Rational& operator/=(const Rational& other) {
-        dividend *= other.divisor;
-        divisor *= other.dividend;
-        BigInteger nod = gcd(dividend, divisor);
-        divisor /= nod;
-        dividend /= nod;
+    static void negate_limbs(int* number, size_t size) {
+        size_t i = 0;
 
-        if (divisor < 0) {
+        while (i < size && number[i] == 0) {
+            ++i;
+        }
 
-            divisor.sign_ = Sign::positive;
+        if (i < size) {
+            number[i] = base_ - number[i];
+            ++i;
+        }
 
-            if (dividend != 0) {
-                dividend.sign_ = (static_cast<bool>(dividend.sign_)) ? Sign::negative : Sign::positive;
-            }
+        for (; i < size; ++i) {
+            number[i] = base_ - 1 - number[i];
+        }
+    }
 
+    static bool eight_digits(const char* chars) {
+        if constexpr (std::endian::native != std::endian::little) {
+            return std::all_of(chars, chars + 8, [](char digit) {
+                return digit >= '0' && digit <= '9';
+            });
         }
 
-        return *this;
+        unsigned long long value;
+        std::memcpy(&value, chars, sizeof(value));
+        return ((value & 0xf0f0f0f0f0f0f0f0ull) | ((value + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4) ==
+               0x3333333333333333ull;
     }
 
-    Rational operator-() const {
-        Rational result = *this;
-        result.dividend *= -1;
-        return result;
+    static int parse_digits(const char* chars, size_t count) {
+        int limb = 0;
+
+        if constexpr (std::endian::native == std::endian::little) {
+            if (count >= 8) {
+                unsigned long long value;
+                std::memcpy(&value, chars, sizeof(value));
+                value -= 0x3030303030303030ull;
+                value = value * 10 + (value >> 8);
+                limb = ((value & 0x000000ff000000ffull) * (100 + (1000000ull << 32)) +
+                        (value >> 16 & 0x000000ff000000ffull) * (1 + (10000ull << 32))) >> 32;
+                chars += 8;
+                count -= 8;
+            }
+        }
+
+        for (; count > 0; --count) {
+            limb = limb * 10 + (*chars++ - '0');
+        }
+
+        return limb;
     }
 
-    std::weak_ordering operator<=>(const Rational& other) {
+    static void divide_limbs_exact(int* first, size_t first_size, int divisor) {
+        long long rest = 0;
 
-        if (dividend.sign_ != other.dividend.sign_) {
-            return dividend.sign_ <=> other.dividend.sign_;
+        for (size_t i = first_size; i > 0; --i) {
+            long long number = rest * base_ + first[i - 1];
+            first[i - 1] = number / divisor;
+            rest = number % divisor;
         }
-
-        return dividend * other.divisor <=> divisor * other.dividend;
     }
 
-    bool operator==(const Rational& other) {
+    static int inverse_limb(int limb) {
+        static const int digit_inverse[10] = {0, 1, 0, 7, 0, 0, 0, 3, 0, 9};
+        long long inverse = digit_inverse[limb % 10];
 
-        if (dividend.sign_ != other.dividend.sign_) {
-            return static_cast<bool>(dividend.sign_);
+        for (long long precision = 10; precision < base_; precision *= precision) {
+            long long error = (2 - static_cast<long long>(limb) * inverse % base_ + base_) % base_;
+            inverse = inverse * error % base_;
         }
 
-        return (dividend == other.dividend && divisor == other.divisor);
+        return inverse;
     }
 
-    std::string toString() const {
+    static void divide_limbs_exact(int* first, size_t size, const int* second, size_t second_size) {
+        long long inverse = inverse_limb(second[0]);
+
+        for (size_t i = 0; i < size; ++i) {
+            int digit = first[i] * inverse % base_;
+            submul_limbs(first + i, size - i, second, std::min(second_size, size - i), digit);
+            first[i] = digit;
+        }
+    }
+
+    static void multiply_unbalanced(const int* first, size_t first_size, const int* second, size_t second_size,
+                                    int* result, const Alloc& alloc) {
+        std::fill(result, result + first_size + second_size, 0);
+        buffer part(2 * second_size, 0, alloc);
+
+        for (size_t i = 0; i < first_size; i += second_size) {
+            size_t length = std::min(second_size, first_size - i);
+            multiply_limbs(first + i, length, second, second_size, part.data(), alloc);
+            add_limbs(result + i, first_size + second_size - i, part.data(), length + second_size);
+        }
+    }
+
+    static void mul_karatsuba(const int* first, size_t first_size, const int* second, size_t second_size,
+                              int* result, const Alloc& alloc) {
+        size_t half = (first_size + 1) / 2;
+        size_t high_first = first_size - half;
+        size_t high_second = second_size > half ? second_size - half : 0;
+        size_t low_second = second_size - high_second;
+
+        buffer low(2 * half, 0, alloc);
+        buffer high(high_first + high_second, 0, alloc);
+        multiply_limbs(first, half, second, low_second, low.data(), alloc);
+        multiply_limbs(first + half, high_first, second + half, high_second, high.data(), alloc);
+
+        buffer first_sum(first, first + half, alloc);
+        buffer second_sum(second, second + low_second, alloc);
+        first_sum.resize(half + 1);
+        second_sum.resize(half + 1);
+        add_limbs(first_sum.data(), first_sum.size(), first + half, high_first);
+        add_limbs(second_sum.data(), second_sum.size(), second + half, high_second);
+
+        buffer middle(2 * half + 2, 0, alloc);
+        multiply_limbs(first_sum.data(), first_sum.size(), second_sum.data(), second_sum.size(), middle.data(), alloc);
+        submul_limbs(middle.data(), middle.size(), low.data(), low.size(), 1);
+        submul_limbs(middle.data(), middle.size(), high.data(), high.size(), 1);
+
+        std::fill(result, result + first_size + second_size, 0);
+        std::copy(low.begin(), low.end(), result);
+        std::copy(high.begin(), high.end(), result + 2 * half);
+        add_limbs(result + half, first_size + second_size - half, middle.data(), middle.size());
+    }
+
+    static buffer toom_evaluate(const int* number, size_t size, size_t part, int point, const Alloc& alloc) {
+        buffer value(part + 1, 0, alloc);
+        long long carry = 0;
+
+        for (size_t i = 0; i < part; ++i) {
+            long long limb = carry;
+            long long power = 1;
+
+            for (size_t j = i; j < size; j += part) {
+                limb += power * number[j];
+                power *= point;
+            }
+
+            value[i] = limb % base_;
+            carry = limb / base_;
+        }
+
+        value[part] = carry;
+        return value;
+    }
+
+    static void mul_toom3(const int* first, size_t first_size, const int* second, size_t second_size,
+                          int* result, const Alloc& alloc) {
+        size_t part = (first_size + 2) / 3;
+        buffer first_parts(3 * part, 0, alloc);
+        buffer second_parts(3 * part, 0, alloc);
+        std::copy(first, first + first_size, first_parts.begin());
+        std::copy(second, second + second_size, second_parts.begin());
+
+        buffer values[5] = {buffer(alloc), buffer(alloc), buffer(alloc), buffer(alloc), buffer(alloc)};
+        values[0].resize(2 * part);
+        multiply_limbs(first_parts.data(), part, second_parts.data(), part, values[0].data(), alloc);
+        values[4].resize(2 * part);
+        multiply_limbs(first_parts.data() + 2 * part, part, second_parts.data() + 2 * part, part, values[4].data(), alloc);
+
+        for (int point = 1; point <= 3; ++point) {
+            buffer first_value = toom_evaluate(first_parts.data(), first_parts.size(), part, point, alloc);
+            buffer second_value = toom_evaluate(second_parts.data(), second_parts.size(), part, point, alloc);
+            values[point].resize(2 * part + 2);
+            multiply_limbs(first_value.data(), part + 1, second_value.data(), part + 1, values[point].data(), alloc);
+        }
+
+        for (int point = 1; point <= 3; ++point) {
+            submul_limbs(values[point].data(), values[point].size(), values[0].data(), values[0].size(), 1);
+            submul_limbs(values[point].data(), values[point].size(), values[4].data(), values[4].size(),
+                         point * point * point * point);
+        }
+
+        divide_limbs_exact(values[2].data(), values[2].size(), 2);
+        divide_limbs_exact(values[3].data(), values[3].size(), 3);
+        submul_limbs(values[3].data(), values[3].size(), values[2].data(), values[2].size(), 1);
+        submul_limbs(values[2].data(), values[2].size(), values[1].data(), values[1].size(), 1);
+        submul_limbs(values[3].data(), values[3].size(), values[2].data(), values[2].size(), 1);
+        divide_limbs_exact(values[3].data(), values[3].size(), 2);
+        submul_limbs(values[2].data(), values[2].size(), values[3].data(), values[3].size(), 3);
+        submul_limbs(values[1].data(), values[1].size(), values[2].data(), values[2].size(), 1);
+        submul_limbs(values[1].data(), values[1].size(), values[3].data(), values[3].size(), 1);
+
+        std::fill(result, result + first_size + second_size, 0);
+
+        for (size_t i = 0; i < 5; ++i) {
+            size_t shift = i * part;
+
+            if (shift < first_size + second_size) {
+                add_limbs(result + shift, first_size + second_size - shift, values[i].data(), values[i].size());
+            }
+        }
+    }
+
+    static constexpr size_t ntt_max_size_ = size_t(1) << 23;
+
+    template <unsigned Mod>
+    static constexpr unsigned power_mod(unsigned long long number, unsigned long long power) {
+        unsigned long long result = 1;
+        number %= Mod;
+
+        while (power > 0) {
+            if (power % 2 == 1) {
+                result = result * number % Mod;
+            }
+
+            number = number * number % Mod;
+            power /= 2;
+        }
+
+        return result;
+    }
+
+    template <unsigned Mod, unsigned Root>
+    static void ntt(ntt_buffer& values, bool invert) {
+        size_t size = values.size();
+
+        BigIntegerThreadPool::parallel_chunks(size, [&](size_t begin, size_t end) {
+            size_t j = 0;
+
+            for (size_t bit = 1, reversed = size >> 1; bit < size; bit <<= 1, reversed >>= 1) {
+                if ((begin & bit) != 0) {
+                    j |= reversed;
+                }
+            }
+
+            for (size_t i = begin; i < end; ++i) {
+                if (i < j) {
+                    std::swap(values[i], values[j]);
+                }
+
+                size_t bit = size >> 1;
+
+                for (; (j & bit) != 0; bit >>= 1) {
+                    j ^= bit;
+                }
+
+                j ^= bit;
+            }
+        });
+
+        ntt_buffer roots(size / 2, 0, values.get_allocator());
+
+        for (size_t length = 2; length <= size; length <<= 1) {
+            size_t half = length / 2;
+            unsigned long long step = power_mod<Mod>(Root, (Mod - 1) / length);
+
+            if (invert) {
+                step = power_mod<Mod>(step, Mod - 2);
+            }
+
+            BigIntegerThreadPool::parallel_chunks(half, [&](size_t begin, size_t end) {
+                unsigned long long root = power_mod<Mod>(step, begin);
+
+                for (size_t i = begin; i < end; ++i) {
+                    roots[i] = root;
+                    root = root * step % Mod;
+                }
+            });
+
+            BigIntegerThreadPool::parallel_chunks(size / 2, [&](size_t begin, size_t end) {
+                for (size_t k = begin; k < end;) {
+                    unsigned* low = values.data() + ((k & ~(half - 1)) << 1);
+                    unsigned* high = low + half;
+                    const unsigned* root = roots.data();
+                    size_t stop = std::min(half, (k & (half - 1)) + (end - k));
+
+                    for (size_t j = k & (half - 1); j < stop; ++j, ++k) {
+                        unsigned first = low[j];
+                        unsigned second = static_cast<unsigned long long>(high[j]) * root[j] % Mod;
+                        low[j] = first + second < Mod ? first + second : first + second - Mod;
+                        high[j] = first >= second ? first - second : first + Mod - second;
+                    }
+                }
+            });
+        }
+
+        if (invert) {
+            unsigned long long inverse = power_mod<Mod>(size, Mod - 2);
+
+            BigIntegerThreadPool::parallel_chunks(size, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    values[i] = values[i] * inverse % Mod;
+                }
+            });
+        }
+    }
+
+    template <unsigned Mod, unsigned Root>
+    static ntt_buffer convolution_mod(const int* first, size_t first_size, const int* second, size_t second_size,
+                                      size_t size, const Alloc& alloc) {
+        ntt_buffer first_values(size, 0, alloc);
+
+        for (size_t i = 0; i < first_size; ++i) {
+            first_values[i] = first[i] % Mod;
+        }
+
+        ntt<Mod, Root>(first_values, false);
+
+        if (first == second && first_size == second_size) {
+
+            for (unsigned& value : first_values) {
+                value = static_cast<unsigned long long>(value) * value % Mod;
+            }
+
+        }
+
+        else {
+            ntt_buffer second_values(size, 0, alloc);
+
+            for (size_t i = 0; i < second_size; ++i) {
+                second_values[i] = second[i] % Mod;
+            }
+
+            ntt<Mod, Root>(second_values, false);
+
+            for (size_t i = 0; i < size; ++i) {
+                first_values[i] = static_cast<unsigned long long>(first_values[i]) * second_values[i] % Mod;
+            }
+        }
+
+        ntt<Mod, Root>(first_values, true);
+        return first_values;
+    }
+
+    static void mul_ntt(const int* first, size_t first_size, const int* second, size_t second_size,
+                        int* result, const Alloc& alloc) {
+        if (first_size + second_size > ntt_max_size_) {
+
+            if (first_size < second_size) {
+                std::swap(first, second);
+                std::swap(first_size, second_size);
+            }
+
+            size_t half = first_size / 2;
+            std::fill(result, result + first_size + second_size, 0);
+            buffer part(first_size - half + second_size, 0, alloc);
+            mul_ntt(first, half, second, second_size, part.data(), alloc);
+            std::copy(part.begin(), part.begin() + half + second_size, result);
+            mul_ntt(first + half, first_size - half, second, second_size, part.data(), alloc);
+            add_limbs(result + half, first_size + second_size - half, part.data(), part.size());
+            return;
+        }
+
+        const unsigned long long first_mod = 998244353;
+        const unsigned long long second_mod = 167772161;
+        const unsigned long long third_mod = 469762049;
+        const unsigned long long first_inverse = power_mod<second_mod>(first_mod, second_mod - 2);
+        const unsigned long long second_inverse = power_mod<third_mod>(first_mod * second_mod, third_mod - 2);
+
+        size_t size = 1;
+
+        while (size < first_size + second_size) {
+            size <<= 1;
+        }
+
+        ntt_buffer first_values(alloc);
+        ntt_buffer second_values(alloc);
+        ntt_buffer third_values(alloc);
+
+        auto convolve = [&](size_t prime) {
+            if (prime == 0) {
+                first_values = convolution_mod<first_mod, 3>(first, first_size, second, second_size, size, alloc);
+            }
+
+            else if (prime == 1) {
+                second_values = convolution_mod<second_mod, 3>(first, first_size, second, second_size, size, alloc);
+            }
+
+            else {
+                third_values = convolution_mod<third_mod, 3>(first, first_size, second, second_size, size, alloc);
+            }
+        };
+
+        if constexpr (std::is_same_v<Alloc, std::allocator<int>>) {
+            BigIntegerThreadPool::parallel_for(3, convolve);
+        }
+
+        else {
+
+            for (size_t prime = 0; prime < 3; ++prime) {
+                convolve(prime);
+            }
+
+        }
+
+        unsigned __int128 carry = 0;
+
+        for (size_t i = 0; i < first_size + second_size; ++i) {
+            unsigned long long residue = first_values[i];
+            unsigned long long second_digit = (second_values[i] + second_mod - residue % second_mod) * first_inverse % second_mod;
+            unsigned long long low = residue + first_mod * second_digit;
+            unsigned long long third_digit = (third_values[i] + third_mod - low % third_mod) * second_inverse % third_mod;
+            carry += low;
+            carry += static_cast<unsigned __int128>(first_mod * second_mod) * third_digit;
+            result[i] = static_cast<int>(carry % base_);
+            carry /= base_;
+        }
+    }
+
+    static constexpr void multiply_limbs(const int* first, size_t first_size, const int* second, size_t second_size,
+                               int* result, const Alloc& alloc) {
+        if (first_size < second_size) {
+            std::swap(first, second);
+            std::swap(first_size, second_size);
+        }
+
+        if (std::is_constant_evaluated()) {
+            mul_basecase(first, first_size, second, second_size, result);
+            return;
+        }
+
+        size_t karatsuba = std::max<size_t>(BigIntegerThresholds::karatsuba, 4);
+        size_t toom3 = std::max(BigIntegerThresholds::toom3, karatsuba);
+
+        if (second_size < karatsuba) {
+            mul_basecase(first, first_size, second, second_size, result);
+        }
+
+        else if (second_size >= BigIntegerThresholds::ntt) {
+            mul_ntt(first, first_size, second, second_size, result, alloc);
+        }
+
+        else if (2 * second_size <= first_size) {
+            multiply_unbalanced(first, first_size, second, second_size, result, alloc);
+        }
+
+        else if (second_size < toom3 || 3 * second_size <= 2 * first_size) {
+            mul_karatsuba(first, first_size, second, second_size, result, alloc);
+        }
+
+        else {
+            mul_toom3(first, first_size, second, second_size, result, alloc);
+        }
+    }
+
+    static void divide_limbs(const int* first, size_t first_size, const int* second, size_t second_size,
+                             int* quotient, int* remainder, const Alloc& alloc) {
+        if (second_size == 1) {
+            long long rest = 0;
+
+            for (size_t i = first_size; i > 0; --i) {
+                long long number = rest * base_ + first[i - 1];
+                quotient[i - 1] = number / second[0];
+                rest = number % second[0];
+            }
+
+            remainder[0] = rest;
+            return;
+        }
+
+        int factor = base_ / (second[second_size - 1] + 1);
+        buffer dividend(first_size + 1, 0, alloc);
+        buffer divisor(second_size + 1, 0, alloc);
+        mul_small_limbs(first, first_size, factor, dividend.data());
+        mul_small_limbs(second, second_size, factor, divisor.data());
+        long long top = divisor[second_size - 1];
+        long long next = divisor[second_size - 2];
+
+        for (size_t j = first_size - second_size + 1; j > 0; --j) {
+            int* window = dividend.data() + j - 1;
+            long long number = static_cast<long long>(window[second_size]) * base_ + window[second_size - 1];
+            long long estimate = number / top;
+            long long rest = number % top;
+
+            while (estimate >= base_ || estimate * next > rest * base_ + window[second_size - 2]) {
+                --estimate;
+                rest += top;
+
+                if (rest >= base_) {
+                    break;
+                }
+            }
+
+            long long borrow = 0;
+            long long carry = 0;
+
+            for (size_t i = 0; i < second_size; ++i) {
+                long long product = estimate * divisor[i] + carry;
+                carry = product / base_;
+                long long difference = window[i] - product % base_ - borrow;
+                borrow = difference < 0 ? 1 : 0;
+                window[i] = difference + borrow * base_;
+            }
+
+            long long difference = window[second_size] - carry - borrow;
+
+            if (difference < 0) {
+                window[second_size] = difference + base_;
+                --estimate;
+                int add_carry = 0;
+
+                for (size_t i = 0; i < second_size; ++i) {
+                    window[i] += divisor[i] + add_carry;
+                    add_carry = window[i] >= base_ ? 1 : 0;
+                    window[i] -= add_carry * base_;
+                }
+
+                window[second_size] = (window[second_size] + add_carry) % base_;
+            }
+
+            else {
+                window[second_size] = difference;
+            }
+
+            quotient[j - 1] = estimate;
+        }
+
+        divide_limbs_exact(dividend.data(), second_size, factor);
+        std::copy(dividend.begin(), dividend.begin() + second_size, remainder);
+    }
+
+    static constexpr void mul_small_limbs(const int* number, size_t size, int factor, int* result) {
+        long long carry = 0;
+
+        for (size_t i = 0; i < size; ++i) {
+            long long product = static_cast<long long>(number[i]) * factor + carry;
+            result[i] = product % base_;
+            carry = product / base_;
+        }
+
+        result[size] = carry;
+    }
+
+    static BasicBigInteger limbs_slice(const BasicBigInteger& number, size_t from, size_t to) {
+        BasicBigInteger result(number.get_allocator());
+        to = std::min(to, number.arr_.size());
+
+        if (from < to) {
+            result.arr_.assign(number.arr_.begin() + from, number.arr_.begin() + to);
+            result.clear_zero();
+        }
+
+        return result;
+    }
+
+    void shift_limbs(size_t count) {
+        if (arr_[arr_.size() - 1] != 0) {
+            arr_.insert(arr_.begin(), count, 0);
+        }
+    }
+
+    static void divide_classic(const BasicBigInteger& first, const BasicBigInteger& second,
+                               BasicBigInteger& quotient, BasicBigInteger& remainder) {
+        if (first.arr_.size() < second.arr_.size()) {
+            remainder = first;
+            remainder.sign_ = Sign::positive;
+            quotient = 0;
+            return;
+        }
+
+        BasicBigInteger new_quotient(first.get_allocator());
+        BasicBigInteger new_remainder(first.get_allocator());
+        new_quotient.arr_.resize(first.arr_.size() - second.arr_.size() + 1);
+        new_remainder.arr_.resize(second.arr_.size());
+        divide_limbs(first.arr_.data(), first.arr_.size(), second.arr_.data(), second.arr_.size(),
+                     new_quotient.arr_.data(), new_remainder.arr_.data(), first.get_allocator());
+        new_quotient.clear_zero();
+        new_remainder.clear_zero();
+        quotient = std::move(new_quotient);
+        remainder = std::move(new_remainder);
+    }
+
+    static void divide_two_by_one(const BasicBigInteger& first, const BasicBigInteger& second, size_t size,
+                                  BasicBigInteger& quotient, BasicBigInteger& remainder) {
+        if (size % 2 == 1 || size < std::max<size_t>(BigIntegerThresholds::burnikel_ziegler, 2)) {
+            divide_classic(first, second, quotient, remainder);
+            return;
+        }
+
+        size_t half = size / 2;
+        BasicBigInteger high_quotient(first.get_allocator());
+        BasicBigInteger rest(first.get_allocator());
+        divide_three_by_two(limbs_slice(first, half, 2 * size), second, half, high_quotient, rest);
+        rest.shift_limbs(half);
+        rest += limbs_slice(first, 0, half);
+        divide_three_by_two(rest, second, half, quotient, remainder);
+        high_quotient.shift_limbs(half);
+        quotient += high_quotient;
+    }
+
+    static void divide_three_by_two(const BasicBigInteger& first, const BasicBigInteger& second, size_t half,
+                                    BasicBigInteger& quotient, BasicBigInteger& remainder) {
+        BasicBigInteger high = limbs_slice(second, half, 2 * half);
+        BasicBigInteger rest(first.get_allocator());
+
+        if (limbs_slice(first, 2 * half, 3 * half) < high) {
+            divide_two_by_one(limbs_slice(first, half, 3 * half), high, half, quotient, rest);
+        }
+
+        else {
+            quotient = 0;
+            quotient.arr_.assign(half, base_ - 1);
+            rest = limbs_slice(first, half, 2 * half);
+            rest += high;
+        }
+
+        BasicBigInteger product = quotient;
+        product *= limbs_slice(second, 0, half);
+        rest.shift_limbs(half);
+        rest += limbs_slice(first, 0, half);
+
+        while (rest < product) {
+            --quotient;
+            rest += second;
+        }
+
+        rest -= product;
+        remainder = std::move(rest);
+    }
+
+    static BasicBigInteger reciprocal(const BasicBigInteger& number) {
+        size_t size = number.arr_.size();
+
+        if (size < std::max<size_t>(BigIntegerThresholds::burnikel_ziegler, 2)) {
+            BasicBigInteger power(1, number.get_allocator());
+            power.shift_limbs(2 * size);
+            BasicBigInteger result(number.get_allocator());
+            BasicBigInteger rest(number.get_allocator());
+            divide_classic(power, number, result, rest);
+            return result;
+        }
+
+        size_t half = (size + 1) / 2;
+        BasicBigInteger result = reciprocal(limbs_slice(number, size - half, size));
+        BasicBigInteger error = number;
+        error *= result;
+        BasicBigInteger power(1, number.get_allocator());
+        power.shift_limbs(size + half);
+        bool below = error <= power;
+
+        if (below) {
+            power -= error;
+            error = std::move(power);
+        }
+
+        else {
+            error -= power;
+        }
+
+        error *= result;
+        error = limbs_slice(error, 2 * half, error.arr_.size());
+        result.shift_limbs(size - half);
+
+        if (below) {
+            result += error;
+        }
+
+        else {
+            result -= error;
+        }
+
+        return result;
+    }
+
+    static void divide_recursive(const BasicBigInteger& first, const BasicBigInteger& second, bool newton,
+                                 BasicBigInteger& quotient, BasicBigInteger& remainder) {
+        size_t size = second.arr_.size();
+        size_t blocks = 1;
+        size_t block_size = std::max<size_t>(BigIntegerThresholds::burnikel_ziegler, 2);
+
+        while (!newton && blocks * block_size < size) {
+            blocks *= 2;
+        }
+
+        size_t length = (size + blocks - 1) / blocks * blocks;
+        int factor = base_ / (second.arr_[size - 1] + 1);
+        BasicBigInteger divisor = second;
+        divisor.sign_ = Sign::positive;
+        divisor *= factor;
+        divisor.shift_limbs(length - size);
+        BasicBigInteger dividend = first;
+        dividend.sign_ = Sign::positive;
+        dividend *= factor;
+        dividend.shift_limbs(length - size);
+        BasicBigInteger inverse = newton ? reciprocal(divisor) : BasicBigInteger(first.get_allocator());
+
+        size_t count = std::max<size_t>(2, (dividend.arr_.size() + length) / length);
+        BasicBigInteger result(first.get_allocator());
+        BasicBigInteger rest = limbs_slice(dividend, (count - 1) * length, count * length);
+
+        for (size_t i = count - 1; i > 0; --i) {
+            rest.shift_limbs(length);
+            rest += limbs_slice(dividend, (i - 1) * length, i * length);
+            BasicBigInteger part(first.get_allocator());
+
+            if (newton) {
+                part = limbs_slice(rest, length - 1, rest.arr_.size());
+                part *= inverse;
+                part = limbs_slice(part, length + 1, part.arr_.size());
+                BasicBigInteger product = part;
+                product *= divisor;
+
+                while (product > rest) {
+                    --part;
+                    product -= divisor;
+                }
+
+                rest -= product;
+
+                while (rest >= divisor) {
+                    ++part;
+                    rest -= divisor;
+                }
+            }
+
+            else {
+                BasicBigInteger current = std::move(rest);
+                divide_two_by_one(current, divisor, length, part, rest);
+            }
+
+            result.shift_limbs(length);
+            result += part;
+        }
+
+        rest = limbs_slice(rest, length - size, rest.arr_.size());
+        rest /= factor;
+        quotient = std::move(result);
+        remainder = std::move(rest);
+    }
+
+    static void divide_abs(const BasicBigInteger& first, const BasicBigInteger& second,
+                           BasicBigInteger& quotient, BasicBigInteger& remainder) {
+        size_t size = second.arr_.size();
+        size_t burnikel_ziegler = std::max<size_t>(BigIntegerThresholds::burnikel_ziegler, 2);
+
+        if (size < burnikel_ziegler || first.arr_.size() < size + burnikel_ziegler) {
+            divide_classic(first, second, quotient, remainder);
+        }
+
+        else {
+            divide_recursive(first, second, size >= BigIntegerThresholds::newton, quotient, remainder);
+        }
+    }
+
+    static unsigned long long gcd_word(unsigned long long first, unsigned long long second) {
+        if (first == 0 || second == 0) {
+            return first | second;
+        }
+
+        int shift = std::countr_zero(first | second);
+        first >>= std::countr_zero(first);
+
+        while (second != 0) {
+            second >>= std::countr_zero(second);
+
+            if (first > second) {
+                std::swap(first, second);
+            }
+
+            second -= first;
+        }
+
+        return first << shift;
+    }
+
+    static bool lehmer_cofactors(const storage& first, const storage& second, long long* cofactors) {
+        size_t size = first.size();
+        long long x = static_cast<long long>(first[size - 1]) * base_ + first[size - 2];
+        long long y = (second.size() == size ? static_cast<long long>(second[size - 1]) * base_ : 0) +
+                      (second.size() >= size - 1 ? second[size - 2] : 0);
+        long long a = 1;
+        long long b = 0;
+        long long c = 0;
+        long long d = 1;
+
+        while (y + c != 0 && y + d != 0) {
+            long long quotient = (x + a) / (y + c);
+
+            if (quotient != (x + b) / (y + d)) {
+                break;
+            }
+
+            if (c != 0 && quotient > (base_ - std::abs(a)) / std::abs(c)) {
+                break;
+            }
+
+            if (d != 0 && quotient > (base_ - std::abs(b)) / std::abs(d)) {
+                break;
+            }
+
+            long long next = a - quotient * c;
+            a = c;
+            c = next;
+            next = b - quotient * d;
+            b = d;
+            d = next;
+            next = x - quotient * y;
+            x = y;
+            y = next;
+        }
+
+        cofactors[0] = a;
+        cofactors[1] = b;
+        cofactors[2] = c;
+        cofactors[3] = d;
+        return b != 0;
+    }
+
+    static void combine_limbs(const int* first, const int* second, size_t size,
+                              long long first_factor, long long second_factor, int* result) {
+        long long carry = 0;
+
+        for (size_t i = 0; i < size; ++i) {
+            long long number = first_factor * first[i] + second_factor * second[i] + carry;
+            long long limb = number % base_;
+            carry = number / base_;
+
+            if (limb < 0) {
+                limb += base_;
+                --carry;
+            }
+
+            result[i] = limb;
+        }
+    }
+
+    constexpr long long small_value() const {
+        return static_cast<bool>(sign_) ? arr_[0] : -static_cast<long long>(arr_[0]);
+    }
+
+    static constexpr unsigned long long magnitude(long long number) {
+        return number < 0 ? 0ull - static_cast<unsigned long long>(number) : number;
+    }
+
+    constexpr void assign_small(long long number) {
+        unsigned long long value = magnitude(number);
+        sign_ = number < 0 ? Sign::negative : Sign::positive;
+        arr_.clear();
+
+        do {
+            arr_.push_back(value % base_);
+            value /= base_;
+        } while (value > 0);
+    }
+
+    static constexpr std::weak_ordering compare_limbs(const storage& first, const storage& second) {
+        if (first.size() != second.size()) {
+            return first.size() <=> second.size();
+        }
+
+        for (size_t i = first.size(); i > 0; --i) {
+
+            if (first[i - 1] != second[i - 1]) {
+                return first[i - 1] <=> second[i - 1];
+            }
+
+        }
+
+        return std::weak_ordering::equivalent;
+    }
+
+    constexpr void add(const BasicBigInteger& other, bool subtract) {
+        Sign other_sign = subtract == static_cast<bool>(other.sign_) ? Sign::negative : Sign::positive;
+
+        if (arr_.size() == 1 && other.arr_.size() == 1) {
+            long long value = other.arr_[0];
+            assign_small(small_value() + (static_cast<bool>(other_sign) ? value : -value));
+            return;
+        }
+
+        if (sign_ == other_sign) {
+            arr_.resize(std::max(arr_.size(), other.arr_.size()) + 1);
+            add_limbs(arr_.data(), arr_.size(), other.arr_.data(), other.arr_.size());
+        }
+
+        else if (compare_limbs(arr_, other.arr_) >= 0) {
+            submul_limbs(arr_.data(), arr_.size(), other.arr_.data(), other.arr_.size(), 1);
+        }
+
+        else {
+            storage result = other.arr_;
+            submul_limbs(result.data(), result.size(), arr_.data(), arr_.size(), 1);
+            arr_ = std::move(result);
+            sign_ = other_sign;
+        }
+
+        clear_zero();
+
+        if (arr_[arr_.size() - 1] == 0) {
+            sign_ = Sign::positive;
+        }
+    }
+
+    void add_product(const BasicBigInteger& first, const BasicBigInteger& second, bool subtract) {
+        Sign product_sign = (static_cast<bool>(first.sign_) == static_cast<bool>(second.sign_)) != subtract ?
+                            Sign::positive : Sign::negative;
+
+        if (arr_.size() == 1 && first.arr_.size() == 1 && second.arr_.size() == 1) {
+            long long product = static_cast<long long>(first.arr_[0]) * second.arr_[0];
+            assign_small(small_value() + (static_cast<bool>(product_sign) ? product : -product));
+            return;
+        }
+
+        if (first.arr_[first.arr_.size() - 1] == 0 || second.arr_[second.arr_.size() - 1] == 0) {
+            return;
+        }
+
+        if (arr_[arr_.size() - 1] == 0) {
+            sign_ = product_sign;
+        }
+
+        size_t size = first.arr_.size() + second.arr_.size();
+        bool subtract_limbs = sign_ != product_sign;
+        int overflow = 0;
+
+        if (this == &first || this == &second ||
+            std::min(first.arr_.size(), second.arr_.size()) >= BigIntegerThresholds::karatsuba) {
+            storage product(size + 1, 0, arr_.get_allocator());
+            multiply_limbs(first.arr_.data(), first.arr_.size(), second.arr_.data(), second.arr_.size(),
+                           product.data(), arr_.get_allocator());
+            int one = 1;
+            arr_.resize(std::max(arr_.size(), size) + 1);
+            overflow = addmul_limbs(arr_.data(), arr_.size(), product.data(), size, &one, 1, subtract_limbs);
+        }
+
+        else {
+            arr_.resize(std::max(arr_.size(), size) + 1);
+            overflow = addmul_limbs(arr_.data(), arr_.size(), first.arr_.data(), first.arr_.size(),
+                                    second.arr_.data(), second.arr_.size(), subtract_limbs);
+        }
+
+        if (subtract_limbs && overflow != 0) {
+            negate_limbs(arr_.data(), arr_.size());
+            sign_ = product_sign;
+        }
+
+        clear_zero();
+
+        if (arr_[arr_.size() - 1] == 0) {
+            sign_ = Sign::positive;
+        }
+    }
+
+    constexpr void add_small(long long number, bool subtract) {
+        unsigned long long value = magnitude(number);
+        Sign other_sign = subtract == (number >= 0) ? Sign::negative : Sign::positive;
+
+        if (value >= static_cast<unsigned long long>(base_)) {
+            BasicBigInteger other(value, get_allocator());
+            other.sign_ = other_sign;
+            add(other, false);
+            return;
+        }
+
+        if (arr_.size() == 1) {
+            long long signed_value = value;
+            assign_small(small_value() + (static_cast<bool>(other_sign) ? signed_value : -signed_value));
+            return;
+        }
+
+        int limb = value;
+
+        if (sign_ == other_sign) {
+            arr_.push_back(0);
+            add_limbs(arr_.data(), arr_.size(), &limb, 1);
+        }
+
+        else {
+            submul_limbs(arr_.data(), arr_.size(), &limb, 1, 1);
+        }
+
+        clear_zero();
+    }
+
+    constexpr void mul_small(long long number) {
+        unsigned long long value = magnitude(number);
+
+        if (value >= static_cast<unsigned long long>(base_)) {
+            BasicBigInteger other(value, get_allocator());
+            other.sign_ = number < 0 ? Sign::negative : Sign::positive;
+            *this *= other;
+            return;
+        }
+
+        if (number < 0) {
+            sign_ = static_cast<bool>(sign_) ? Sign::negative : Sign::positive;
+        }
+
+        arr_.push_back(0);
+        mul_small_limbs(arr_.data(), arr_.size() - 1, static_cast<int>(value), arr_.data());
+        clear_zero();
+
+        if (arr_[arr_.size() - 1] == 0) {
+            sign_ = Sign::positive;
+        }
+    }
+
+    int remainder_small(int number) const {
+        long long rest = 0;
+
+        for (size_t i = arr_.size(); i > 0; --i) {
+            rest = (rest * base_ + arr_[i - 1]) % number;
+        }
+
+        return rest;
+    }
+
+    long long divmod_small(long long number) {
+        unsigned long long value = magnitude(number);
+
+        if (value >= static_cast<unsigned long long>(base_)) {
+            BasicBigInteger other(value, get_allocator());
+            other.sign_ = number < 0 ? Sign::negative : Sign::positive;
+            BasicBigInteger remainder = *this;
+            remainder.divide(other, true);
+            divide(other, false);
+            unsigned long long rest = 0;
+
+            for (size_t i = remainder.arr_.size(); i > 0; --i) {
+                rest = rest * base_ + remainder.arr_[i - 1];
+            }
+
+            return static_cast<bool>(remainder.sign_) ? rest : -static_cast<long long>(rest);
+        }
+
+        long long rest = 0;
+
+        for (size_t i = arr_.size(); i > 0; --i) {
+            long long current = rest * base_ + arr_[i - 1];
+            arr_[i - 1] = current / static_cast<long long>(value);
+            rest = current % static_cast<long long>(value);
+        }
+
+        if (!static_cast<bool>(sign_)) {
+            rest = -rest;
+        }
+
+        if (number < 0) {
+            sign_ = static_cast<bool>(sign_) ? Sign::negative : Sign::positive;
+        }
+
+        clear_zero();
+
+        if (arr_[arr_.size() - 1] == 0) {
+            sign_ = Sign::positive;
+        }
+
+        return rest;
+    }
+
+    void divide(const BasicBigInteger& other, bool keep_remainder) {
+        if (arr_.size() == 1 && other.arr_.size() == 1) {
+            long long value = small_value();
+            assign_small(keep_remainder ? value % other.small_value() : value / other.small_value());
+            return;
+        }
+
+        BasicBigInteger quotient(get_allocator());
+        BasicBigInteger remainder(get_allocator());
+        divide_abs(*this, other, quotient, remainder);
+
+        if (keep_remainder) {
+            remainder.sign_ = remainder.arr_[remainder.arr_.size() - 1] != 0 ? sign_ : Sign::positive;
+            *this = std::move(remainder);
+        }
+
+        else {
+            quotient.sign_ = (static_cast<bool>(sign_) == static_cast<bool>(other.sign_) ||
+                              quotient.arr_[quotient.arr_.size() - 1] == 0) ? Sign::positive : Sign::negative;
+            *this = std::move(quotient);
+        }
+    }
+
+    void divide_exact(const BasicBigInteger& other) {
+        size_t size = other.arr_.size();
+
+        if (other.arr_[size - 1] == 0 || (size >= BigIntegerThresholds::divide_exact &&
+                                          arr_.size() >= size + BigIntegerThresholds::divide_exact)) {
+            divide(other, false);
+            return;
+        }
+
+        Sign sign = (static_cast<bool>(sign_) == static_cast<bool>(other.sign_)) ? Sign::positive : Sign::negative;
+
+        if (this == &other) {
+            assign_small(1);
+            return;
+        }
+
+        if (arr_.size() < size) {
+            assign_small(0);
+            return;
+        }
+
+        if (size == 1) {
+            divide_limbs_exact(arr_.data(), arr_.size(), other.arr_[0]);
+        }
+
+        else {
+            size_t shift = 0;
+
+            while (other.arr_[shift] == 0) {
+                ++shift;
+            }
+
+            const int* divisor = other.arr_.data() + shift;
+            size -= shift;
+            storage reduced(get_allocator());
+
+            while (divisor[0] % 2 == 0 || divisor[0] % 5 == 0) {
+                int factor = 1;
+
+                for (int low = divisor[0]; low % 2 == 0 && factor % 512 != 0; low /= 2) {
+                    factor *= 2;
+                }
+
+                for (int low = divisor[0]; low % 5 == 0 && factor % 1953125 != 0; low /= 5) {
+                    factor *= 5;
+                }
+
+                if (reduced.empty()) {
+                    reduced.assign(divisor, divisor + size);
+                }
+
+                divide_limbs_exact(reduced.data(), size, factor);
+                divide_limbs_exact(arr_.data() + shift, arr_.size() - shift, factor);
+                divisor = reduced.data();
+
+                if (reduced[size - 1] == 0) {
+                    --size;
+                }
+            }
+
+            size_t length = arr_.size() - shift - size + 1;
+            divide_limbs_exact(arr_.data() + shift, length, divisor, size);
+            std::copy(arr_.begin() + shift, arr_.begin() + shift + length, arr_.begin());
+            arr_.resize(length);
+        }
+
+        clear_zero();
+        sign_ = arr_[arr_.size() - 1] != 0 ? sign : Sign::positive;
+    }
+
+public:
+
+    constexpr BasicBigInteger() : BasicBigInteger(0) {}
+
+    constexpr explicit BasicBigInteger(const Alloc& alloc) : BasicBigInteger(0, alloc) {}
+
+    constexpr explicit BasicBigInteger(long long unsigned number, const Alloc& alloc = Alloc())
+            : sign_(Sign::positive), arr_(alloc) {
+        while (number>=base_){
+            arr_.push_back(number%base_);
+            number/=base_;
+        }
+        if (number!=0||arr_.empty()){
+            arr_.push_back(number);
+        }
+
+    }
+
+    constexpr BasicBigInteger(int integer, const Alloc& alloc = Alloc())
+            : sign_((integer >= 0 ? Sign::positive : Sign::negative)), arr_(alloc) {
+
+        if (!static_cast<bool>(sign_)) {
+            integer *= -1;
+        }
+
+        while (integer >= base_) {
+            arr_.push_back(integer%base_);
+            integer/=base_;
+        }
+
+       if (integer!=0||arr_.empty()){
+           arr_.push_back(integer);
+       }
+
+    }
+
+    constexpr BasicBigInteger& operator+=(const BasicBigInteger& other) {
+        add(other, false);
+        return *this;
+    }
+
+    constexpr BasicBigInteger& operator-=(const BasicBigInteger& other) {
+        add(other, true);
+        return *this;
+    }
+
+    constexpr BasicBigInteger& operator*=(const BasicBigInteger& other) {
+        if (arr_.size() == 1 && other.arr_.size() == 1) {
+            assign_small(small_value() * other.small_value());
+            return *this;
+        }
+
+        sign_ = (static_cast<bool>(sign_) == static_cast<bool>(other.sign_)) ? Sign::positive : Sign::negative;
+        storage new_arr(arr_.size() + other.arr_.size() + 1, 0, arr_.get_allocator());
+        multiply_limbs(arr_.data(), arr_.size(), other.arr_.data(), other.arr_.size(), new_arr.data(),
+                       arr_.get_allocator());
+        arr_ = std::move(new_arr);
+
+        clear_zero();
+
+        if (arr_[arr_.size() - 1] == 0) {
+            sign_ = Sign::positive;
+        }
+
+        return *this;
+    }
+
+    constexpr BasicBigInteger operator-() const& {
+        BasicBigInteger result = *this;
+        return -std::move(result);
+    }
+
+    constexpr BasicBigInteger operator-() && {
+        if (arr_[arr_.size() - 1] != 0) {
+            sign_ = static_cast<bool>(sign_) ? Sign::negative : Sign::positive;
+        }
+
+        return std::move(*this);
+    }
+
+    constexpr BasicBigInteger& operator+=(long long number) {
+        add_small(number, false);
+        return *this;
+    }
+
+    constexpr BasicBigInteger& operator-=(long long number) {
+        add_small(number, true);
+        return *this;
+    }
+
+    constexpr BasicBigInteger& operator*=(long long number) {
+        mul_small(number);
+        return *this;
+    }
+
+    constexpr BasicBigInteger& operator++() {
+        *this += 1;
+        return *this;
+    }
+
+    constexpr BasicBigInteger operator++(int) {
+        BasicBigInteger result = *this;
+        ++(*this);
+        return result;
+    }
+
+    constexpr BasicBigInteger& operator--() {
+        *this -= 1;
+        return *this;
+    }
+
+    constexpr BasicBigInteger operator--(int) {
+        BasicBigInteger result = *this;
+        --(*this);
+        return result;
+    }
+
+    constexpr explicit operator bool() const { return (arr_[arr_.size() - 1] != 0); }
+
+    constexpr Alloc get_allocator() const { return arr_.get_allocator(); }
+
+    size_t chars_count() const {
+        size_t count = nine_ * (arr_.size() - 1) + (static_cast<bool>(sign_) ? 1 : 2);
+
+        for (int top = arr_[arr_.size() - 1]; top >= 10; top /= 10) {
+            ++count;
+        }
+
+        return count;
+    }
+
+    std::string toString() const {
+        std::string str(chars_count(), '0');
+        to_chars(str.data(), str.data() + str.size(), *this);
+        return str;
+    }
+
+    constexpr std::weak_ordering operator<=>(const BasicBigInteger& other) const {
+        if (sign_!=other.sign_){
+            return (sign_ <=> other.sign_);
+        }
+
+        if (arr_.size() != other.arr_.size()) {
+
+            return (static_cast<bool>(sign_)) ? arr_.size() <=> other.arr_.size() : other.arr_.size() <=> arr_.size();
+
+        }
+
+        for (int i = arr_.size() - 1; i >= 0; --i) {
+
+            if (arr_[i] != other.arr_[i]) {
+
+                return (static_cast<bool>(sign_)) ? arr_[i] <=> other.arr_[i] : other.arr_[i] <=> arr_[i];
+
+            }
+
+        }
+        return std::weak_ordering::equivalent;
+
+    }
+    constexpr bool operator==(const BasicBigInteger& second) const {
+        if (sign_ == second.sign_ && arr_.size() == second.arr_.size()) {
+            int sz = arr_.size();
+
+            for (int i = sz - 1; i >= 0; --i) {
+
+                if (arr_[i] != second.arr_[i]) {
+                    return false;
+                }
+
+            }
+
+            return true;
+        }
+        return false;
+    }
+
+    constexpr ~BasicBigInteger() = default;
+};
+
+constexpr BigInteger operator""_bi(long long unsigned number) {
+    return BigInteger(number);
+}
+
+template <size_t Limbs>
+class StaticBigInteger {
+private:
+    Sign sign_ = Sign::positive;
+    size_t size_ = 1;
+    int arr_[Limbs] = {};
+
+public:
+
+    constexpr StaticBigInteger() = default;
+
+    template <typename Alloc>
+    constexpr StaticBigInteger(const BasicBigInteger<Alloc>& number) : sign_(number.sign_), size_(number.arr_.size()) {
+        if (size_ > Limbs) {
+            throw std::length_error("StaticBigInteger capacity exceeded");
+        }
+
+        std::copy(number.arr_.begin(), number.arr_.end(), arr_);
+    }
+
+    template <typename Alloc>
+    constexpr operator BasicBigInteger<Alloc>() const {
+        BasicBigInteger<Alloc> result;
+        result.arr_.assign(arr_, arr_ + size_);
+        result.sign_ = sign_;
+        return result;
+    }
+};
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator*(BasicBigInteger<Alloc> first, const BasicBigInteger<Alloc>& second) {
+    first *= second;
+    return first;
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator*(const BasicBigInteger<Alloc>& first, BasicBigInteger<Alloc>&& second) {
+    second *= first;
+    return std::move(second);
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc>& addmul(BasicBigInteger<Alloc>& result, const BasicBigInteger<Alloc>& first,
+                               const BasicBigInteger<Alloc>& second) {
+    result.add_product(first, second, false);
+    return result;
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc>& submul(BasicBigInteger<Alloc>& result, const BasicBigInteger<Alloc>& first,
+                               const BasicBigInteger<Alloc>& second) {
+    result.add_product(first, second, true);
+    return result;
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc>& divexact(BasicBigInteger<Alloc>& first, const BasicBigInteger<Alloc>& second) {
+    first.divide_exact(second);
+    return first;
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc> multiply_ntt(const BasicBigInteger<Alloc>& first, const BasicBigInteger<Alloc>& second) {
+    BasicBigInteger<Alloc> result(first.get_allocator());
+    result.sign_ = (static_cast<bool>(first.sign_) == static_cast<bool>(second.sign_)) ? Sign::positive : Sign::negative;
+    result.arr_.resize(first.arr_.size() + second.arr_.size() + 1);
+    BasicBigInteger<Alloc>::mul_ntt(first.arr_.data(), first.arr_.size(), second.arr_.data(), second.arr_.size(),
+                                    result.arr_.data(), first.get_allocator());
+    result.clear_zero();
+
+    if (result.arr_[result.arr_.size() - 1] == 0) {
+        result.sign_ = Sign::positive;
+    }
+
+    return result;
+}
+
+template <typename Alloc>
+std::to_chars_result to_chars(char* first, char* last, const BasicBigInteger<Alloc>& number) {
+    if (static_cast<size_t>(last - first) < number.chars_count()) {
+        return {last, std::errc::value_too_large};
+    }
+
+    if (!static_cast<bool>(number.sign_)) {
+        *first++ = '-';
+    }
+
+    first = std::to_chars(first, last, number.arr_[number.arr_.size() - 1]).ptr;
+
+    for (size_t i = number.arr_.size() - 1; i > 0; --i) {
+        int limb = number.arr_[i - 1];
+
+        for (int j = BasicBigInteger<Alloc>::nine_ - 1; j >= 0; --j) {
+            first[j] = static_cast<char>('0' + limb % 10);
+            limb /= 10;
+        }
+
+        first += BasicBigInteger<Alloc>::nine_;
+    }
+
+    return {first, std::errc()};
+}
+
+template <typename Alloc>
+std::from_chars_result from_chars(const char* first, const char* last, BasicBigInteger<Alloc>& number) {
+    const char* begin = first;
+    Sign sign = Sign::positive;
+
+    if (begin != last && *begin == '-') {
+        sign = Sign::negative;
+        ++begin;
+    }
+
+    const char* end = begin;
+
+    while (last - end >= 16 && BasicBigInteger<Alloc>::eight_digits(end) && BasicBigInteger<Alloc>::eight_digits(end + 8)) {
+        end += 16;
+    }
+
+    while (end != last && *end >= '0' && *end <= '9') {
+        ++end;
+    }
+
+    if (begin == end) {
+        return {first, std::errc::invalid_argument};
+    }
+
+    size_t size = end - begin;
+    size_t full = size / BasicBigInteger<Alloc>::nine_;
+    const char* chunk = end;
+    number.arr_.assign((size + BasicBigInteger<Alloc>::nine_ - 1) / BasicBigInteger<Alloc>::nine_, 0);
+
+    for (size_t i = 0; i < full; ++i) {
+        chunk -= BasicBigInteger<Alloc>::nine_;
+        number.arr_[i] = BasicBigInteger<Alloc>::parse_digits(chunk, BasicBigInteger<Alloc>::nine_);
+    }
+
+    if (full < number.arr_.size()) {
+        number.arr_[full] = BasicBigInteger<Alloc>::parse_digits(begin, chunk - begin);
+    }
+
+    number.clear_zero();
+    number.sign_ = number.arr_[number.arr_.size() - 1] != 0 ? sign : Sign::positive;
+    return {end, std::errc()};
+}
+
+template <typename Alloc>
+std::ostream& operator<<(std::ostream& out, const BasicBigInteger<Alloc>& number) {
+    if (out.width() != 0) {
+        return out << number.toString();
+    }
+
+    char buffer[BasicBigInteger<Alloc>::nine_ + 2];
+    char* first = buffer;
+
+    if (!static_cast<bool>(number.sign_)) {
+        *first++ = '-';
+    }
+
+    first = std::to_chars(first, buffer + sizeof(buffer), number.arr_[number.arr_.size() - 1]).ptr;
+    out.write(buffer, first - buffer);
+
+    for (size_t i = number.arr_.size() - 1; i > 0; --i) {
+        int limb = number.arr_[i - 1];
+
+        for (int j = BasicBigInteger<Alloc>::nine_ - 1; j >= 0; --j) {
+            buffer[j] = static_cast<char>('0' + limb % 10);
+            limb /= 10;
+        }
+
+        out.write(buffer, BasicBigInteger<Alloc>::nine_);
+    }
+
+    return out;
+}
+
+template <typename Alloc>
+std::from_chars_result from_chars(std::string_view input, BasicBigInteger<Alloc>& number) {
+    return from_chars(input.data(), input.data() + input.size(), number);
+}
+
+template <typename Alloc>
+std::istream& operator>>(std::istream& in, BasicBigInteger<Alloc>& number) {
+    static const int powers[BasicBigInteger<Alloc>::nine_] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+    std::istream::sentry sentry(in);
+
+    if (!sentry) {
+        return in;
+    }
+
+    std::streambuf* buffer = in.rdbuf();
+    int symbol = buffer->sgetc();
+    Sign sign = Sign::positive;
+
+    if (symbol == '-') {
+        sign = Sign::negative;
+        buffer->sbumpc();
+    }
+
+    BasicBigInteger<Alloc> result(number.get_allocator());
+    result.arr_.clear();
+    char block[4096];
+    char chunk[BasicBigInteger<Alloc>::nine_];
+    size_t used = 0;
+    bool empty = true;
+
+    while ((symbol = buffer->sgetc()) >= '0' && symbol <= '9') {
+        std::streamsize count = std::min<std::streamsize>(buffer->in_avail(), sizeof(block));
+        count = buffer->sgetn(block, std::max<std::streamsize>(count, 1));
+        const char* first = block;
+        const char* last = block;
+
+        while (block + count - last >= 16 && BasicBigInteger<Alloc>::eight_digits(last) &&
+               BasicBigInteger<Alloc>::eight_digits(last + 8)) {
+            last += 16;
+        }
+
+        while (last != block + count && *last >= '0' && *last <= '9') {
+            ++last;
+        }
+
+        for (const char* rest = block + count; rest != last; --rest) {
+            buffer->sungetc();
+        }
+
+        empty = false;
+
+        for (; used != 0 && used < BasicBigInteger<Alloc>::nine_ && first != last; ++used) {
+            chunk[used] = *first++;
+        }
+
+        if (used == BasicBigInteger<Alloc>::nine_) {
+            result.arr_.push_back(BasicBigInteger<Alloc>::parse_digits(chunk, used));
+            used = 0;
+        }
+
+        for (; last - first >= BasicBigInteger<Alloc>::nine_; first += BasicBigInteger<Alloc>::nine_) {
+            result.arr_.push_back(BasicBigInteger<Alloc>::parse_digits(first, BasicBigInteger<Alloc>::nine_));
+        }
+
+        for (; first != last; ++used) {
+            chunk[used] = *first++;
+        }
+    }
+
+    std::ios::iostate state = std::ios::goodbit;
+
+    if (symbol != std::char_traits<char>::eof() && !std::isspace(static_cast<char>(symbol), in.getloc())) {
+        state |= std::ios::failbit;
+
+        while (symbol != std::char_traits<char>::eof() && !std::isspace(static_cast<char>(symbol), in.getloc())) {
+            symbol = buffer->snextc();
+        }
+    }
+
+    if (symbol == std::char_traits<char>::eof()) {
+        state |= std::ios::eofbit;
+    }
+
+    if (empty || (state & std::ios::failbit)) {
+        in.setstate(state | std::ios::failbit);
+        return in;
+    }
+
+    std::reverse(result.arr_.begin(), result.arr_.end());
+
+    if (result.arr_.empty()) {
+        result.arr_.push_back(0);
+    }
+
+    if (used != 0) {
+        result.mul_small(powers[used]);
+        result.add_small(BasicBigInteger<Alloc>::parse_digits(chunk, used), false);
+    }
+
+    result.sign_ = result.arr_[result.arr_.size() - 1] != 0 ? sign : Sign::positive;
+    number = std::move(result);
+    in.setstate(state);
+    return in;
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator+(BasicBigInteger<Alloc> first, const BasicBigInteger<Alloc>& second) {
+    first += second;
+    return first;
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator+(const BasicBigInteger<Alloc>& first, BasicBigInteger<Alloc>&& second) {
+    second += first;
+    return std::move(second);
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc>& operator/=(BasicBigInteger<Alloc>& first, const BasicBigInteger<Alloc>& second) {
+    first.divide(second, false);
+    return first;
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc>& operator/=(BasicBigInteger<Alloc>& first, long long second) {
+    first.divmod_small(second);
+    return first;
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc>& operator%=(BasicBigInteger<Alloc>& first, long long second) {
+    first.assign_small(first.divmod_small(second));
+    return first;
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc> operator/(BasicBigInteger<Alloc> first, const BasicBigInteger<Alloc>& second) {
+    first /= second;
+    return first;
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc>& operator%=(BasicBigInteger<Alloc>& first, const BasicBigInteger<Alloc>& second) {
+    first.divide(second, true);
+    return first;
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator-(BasicBigInteger<Alloc> first, const BasicBigInteger<Alloc>& second) {
+    first -= second;
+    return first;
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator-(const BasicBigInteger<Alloc>& first, BasicBigInteger<Alloc>&& second) {
+    second -= first;
+    return -std::move(second);
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc> operator%(BasicBigInteger<Alloc> first, const BasicBigInteger<Alloc>& second) {
+    first %= second;
+    return first;
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator+(BasicBigInteger<Alloc> first, long long second) {
+    first += second;
+    return first;
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator-(BasicBigInteger<Alloc> first, long long second) {
+    first -= second;
+    return first;
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator*(BasicBigInteger<Alloc> first, long long second) {
+    first *= second;
+    return first;
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator+(long long first, BasicBigInteger<Alloc> second) {
+    second += first;
+    return second;
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator-(long long first, BasicBigInteger<Alloc> second) {
+    second -= first;
+    return -std::move(second);
+}
+
+template <typename Alloc>
+constexpr BasicBigInteger<Alloc> operator*(long long first, BasicBigInteger<Alloc> second) {
+    second *= first;
+    return second;
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc> operator/(BasicBigInteger<Alloc> first, long long second) {
+    first /= second;
+    return first;
+}
+
+template <typename Alloc>
+BasicBigInteger<Alloc> operator%(BasicBigInteger<Alloc> first, long long second) {
+    first %= second;
+    return first;
+}
+
+BigInteger gcd(BigInteger first, BigInteger second) {
+    first.sign_ = Sign::positive;
+    second.sign_ = Sign::positive;
+
+    if (BigInteger::compare_limbs(first.arr_, second.arr_) < 0) {
+        std::swap(first, second);
+    }
+
+    BigInteger::storage next_first;
+    BigInteger::storage next_second;
+
+    while (second.arr_.size() > 2) {
+        long long cofactors[4];
+
+        if (!BigInteger::lehmer_cofactors(first.arr_, second.arr_, cofactors)) {
+            first %= second;
+            std::swap(first, second);
+            continue;
+        }
+
+        size_t size = first.arr_.size();
+        second.arr_.resize(size);
+        next_first.resize(size);
+        next_second.resize(size);
+        BigInteger::combine_limbs(first.arr_.data(), second.arr_.data(), size, cofactors[0], cofactors[1], next_first.data());
+        BigInteger::combine_limbs(first.arr_.data(), second.arr_.data(), size, cofactors[2], cofactors[3], next_second.data());
+        std::swap(first.arr_, next_first);
+        std::swap(second.arr_, next_second);
+        first.clear_zero();
+        second.clear_zero();
+    }
+
+    if (second.arr_.size() == 1 && second.arr_[0] == 0) {
+        return first;
+    }
+
+    first %= second;
+    unsigned long long first_word = first.arr_[0];
+    unsigned long long second_word = second.arr_[0];
+
+    if (first.arr_.size() > 1) {
+        first_word += static_cast<unsigned long long>(first.arr_[1]) * BigInteger::base_;
+    }
+
+    if (second.arr_.size() > 1) {
+        second_word += static_cast<unsigned long long>(second.arr_[1]) * BigInteger::base_;
+    }
+
+    return BigInteger(BigInteger::gcd_word(first_word, second_word));
+}
+
+BigInteger extended_gcd(const BigInteger& first, const BigInteger& second, BigInteger& x, BigInteger& y) {
+    BigInteger current = first;
+    BigInteger next = second;
+    BigInteger current_factor = 1;
+    BigInteger next_factor = 0;
+    current.sign_ = Sign::positive;
+    next.sign_ = Sign::positive;
+
+    while (next) {
+        long long cofactors[4];
+
+        if (next.arr_.size() > 2 && current.arr_.size() >= next.arr_.size() &&
+            BigInteger::lehmer_cofactors(current.arr_, next.arr_, cofactors)) {
+            size_t size = current.arr_.size();
+            next.arr_.resize(size);
+            BigInteger::storage next_current(size);
+            BigInteger::storage next_next(size);
+            BigInteger::combine_limbs(current.arr_.data(), next.arr_.data(), size, cofactors[0], cofactors[1], next_current.data());
+            BigInteger::combine_limbs(current.arr_.data(), next.arr_.data(), size, cofactors[2], cofactors[3], next_next.data());
+            current.arr_ = std::move(next_current);
+            next.arr_ = std::move(next_next);
+            current.clear_zero();
+            next.clear_zero();
+
+            BigInteger factor = current_factor * cofactors[0] + next_factor * cofactors[1];
+            next_factor = current_factor * cofactors[2] + next_factor * cofactors[3];
+            current_factor = std::move(factor);
+            continue;
+        }
+
+        BigInteger quotient;
+        BigInteger remainder;
+        BigInteger::divide_abs(current, next, quotient, remainder);
+        current = std::move(next);
+        next = std::move(remainder);
+        submul(current_factor, quotient, next_factor);
+        std::swap(current_factor, next_factor);
+    }
+
+    x = first < 0 ? -std::move(current_factor) : std::move(current_factor);
+
+    if (second) {
+        y = current;
+        submul(y, first, x);
+        y /= second;
+    }
+
+    else {
+        y = 0;
+    }
+
+    return current;
+}
+
+size_t exponent_words(BigInteger exponent, std::vector<unsigned>& words) {
+    words.clear();
+
+    while (exponent > 0) {
+        words.push_back(exponent.divmod_small(1 << 30));
+    }
+
+    return words.empty() ? 0 : 30 * (words.size() - 1) + std::bit_width(words.back());
+}
+
+template <typename Multiply>
+BigInteger power_window(const BigInteger& base, const BigInteger& one, const BigInteger& exponent, Multiply multiply) {
+    std::vector<unsigned> bits;
+    size_t bit_count = exponent_words(exponent, bits);
+    auto bit = [&bits](size_t i) {
+        return (bits[i / 30] >> (i % 30)) & 1;
+    };
+
+    int window = bit_count > 671 ? 6 : bit_count > 239 ? 5 : bit_count > 79 ? 4 : bit_count > 23 ? 3 : 1;
+    std::vector<BigInteger> powers(1, base);
+
+    if (window > 1) {
+        BigInteger square = multiply(base, base);
+
+        for (int i = 1; i < (1 << (window - 1)); ++i) {
+            powers.push_back(multiply(powers.back(), square));
+        }
+    }
+
+    BigInteger result = one;
+    bool started = false;
+
+    for (size_t i = bit_count; i > 0;) {
+        if (!bit(i - 1)) {
+            result = multiply(result, result);
+            --i;
+            continue;
+        }
+
+        size_t length = std::min<size_t>(window, i);
+
+        while (!bit(i - length)) {
+            --length;
+        }
+
+        unsigned value = 0;
+
+        for (size_t j = 0; j < length; ++j) {
+            value = value << 1 | bit(i - 1 - j);
+
+            if (started) {
+                result = multiply(result, result);
+            }
+        }
+
+        result = started ? multiply(result, powers[value >> 1]) : powers[value >> 1];
+        started = true;
+        i -= length;
+    }
+
+    return result;
+}
+
+class MontgomeryContext {
+private:
+    BigInteger modulus_;
+    BigInteger one_;
+    BigInteger r_squared_;
+    int inverse_;
+
+    static int split_column(unsigned __int128& column) {
+        unsigned long long high = static_cast<unsigned long long>(column >> 32);
+        unsigned long long low = static_cast<unsigned long long>(column) & 0xffffffffull;
+        unsigned long long rest = (high % BigInteger::base_) << 32 | low;
+        column = static_cast<unsigned __int128>(high / BigInteger::base_) << 32 | rest / BigInteger::base_;
+        return rest % BigInteger::base_;
+    }
+
+    void redc(BigInteger& number) const {
+        size_t size = modulus_.arr_.size();
+        const int* modulus = modulus_.arr_.data();
+        BigInteger::storage quotient(size);
+        BigInteger::storage result(size + 1);
+        unsigned __int128 column = 0;
+
+        for (size_t i = 0; i < 2 * size; ++i) {
+            for (size_t j = i < size ? 0 : i - size + 1; j < std::min(i, size); ++j) {
+                column += static_cast<unsigned long long>(quotient[j]) * modulus[i - j];
+            }
+
+            if (i < number.arr_.size()) {
+                column += number.arr_[i];
+            }
+
+            if (i < size) {
+                unsigned __int128 low = column;
+                quotient[i] = static_cast<unsigned long long>(split_column(low)) * inverse_ % BigInteger::base_;
+                column += static_cast<unsigned long long>(quotient[i]) * modulus[0];
+                split_column(column);
+            }
+
+            else {
+                result[i - size] = split_column(column);
+            }
+        }
+
+        result[size] = static_cast<int>(column);
+        number.arr_ = std::move(result);
+        number.clear_zero();
+
+        if (BigInteger::compare_limbs(number.arr_, modulus_.arr_) >= 0) {
+            BigInteger::submul_limbs(number.arr_.data(), number.arr_.size(), modulus, size, 1);
+            number.clear_zero();
+        }
+    }
+
+public:
+
+    static bool supports(const BigInteger& modulus) {
+        return modulus > 1 && modulus.arr_[0] % 2 != 0 && modulus.arr_[0] % 5 != 0;
+    }
+
+    explicit MontgomeryContext(const BigInteger& modulus) : modulus_(modulus) {
+        int low = modulus.arr_[0];
+
+        if (!supports(modulus)) {
+            throw std::invalid_argument("Montgomery modulus must be greater than 1 and coprime to 10");
+        }
+
+        inverse_ = (BigInteger::base_ - BigInteger::inverse_limb(low)) % BigInteger::base_;
+        size_t size = modulus_.arr_.size();
+        one_.arr_.assign(size + 1, 0);
+        one_.arr_[size] = 1;
+        one_ %= modulus_;
+        r_squared_ = one_ * one_ % modulus_;
+    }
+
+    const BigInteger& modulus() const {
+        return modulus_;
+    }
+
+    const BigInteger& one() const {
+        return one_;
+    }
+
+    BigInteger to_montgomery(const BigInteger& number) const {
+        BigInteger result = number % modulus_;
+
+        if (result < 0) {
+            result += modulus_;
+        }
+
+        result *= r_squared_;
+        redc(result);
+        return result;
+    }
+
+    BigInteger from_montgomery(BigInteger number) const {
+        redc(number);
+        return number;
+    }
+
+    BigInteger mulmod(const BigInteger& first, const BigInteger& second) const {
+        BigInteger result = first * second;
+        redc(result);
+        return result;
+    }
+
+    BigInteger sqrmod(const BigInteger& number) const {
+        return mulmod(number, number);
+    }
+
+    BigInteger power(const BigInteger& base, const BigInteger& exponent) const {
+        return power_window(base, one_, exponent, [this](const BigInteger& first, const BigInteger& second) {
+            return mulmod(first, second);
+        });
+    }
+};
+
+BigInteger powmod(BigInteger base, const BigInteger& exponent, const BigInteger& mod) {
+    if (mod <= 0) {
+        throw std::domain_error("powmod modulus must be positive");
+    }
+
+    if (exponent < 0) {
+        throw std::domain_error("powmod exponent must be non-negative");
+    }
+
+    base %= mod;
+
+    if (base < 0) {
+        base += mod;
+    }
+
+    if (MontgomeryContext::supports(mod)) {
+        MontgomeryContext context(mod);
+        return context.from_montgomery(context.power(context.to_montgomery(base), exponent));
+    }
+
+    return power_window(base, BigInteger(1) % mod, exponent, [&mod](const BigInteger& first, const BigInteger& second) {
+        return first * second % mod;
+    });
+}
+
+const std::vector<int>& small_primes() {
+    static const std::vector<int> primes = [] {
+        static const int limit = 2048;
+        std::vector<bool> composite(limit);
+        std::vector<int> result;
+
+        for (int i = 2; i < limit; ++i) {
+
+            if (composite[i]) {
+                continue;
+            }
+
+            result.push_back(i);
+
+            for (int j = i * i; j < limit; j += i) {
+                composite[j] = true;
+            }
+        }
+
+        return result;
+    }();
+
+    return primes;
+}
+
+template <typename Engine>
+BigInteger random_below(const BigInteger& bound, Engine& engine) {
+    if (bound <= 0) {
+        throw std::invalid_argument("random_below bound must be positive");
+    }
+
+    std::uniform_int_distribution<int> limb(0, BigInteger::base_ - 1);
+    std::uniform_int_distribution<int> top(0, bound.arr_[bound.arr_.size() - 1]);
+    BigInteger result = 0;
+    result.arr_.resize(bound.arr_.size());
+
+    do {
+        for (size_t i = 0; i + 1 < result.arr_.size(); ++i) {
+            result.arr_[i] = limb(engine);
+        }
+
+        result.arr_[result.arr_.size() - 1] = top(engine);
+    } while (BigInteger::compare_limbs(result.arr_, bound.arr_) >= 0);
+
+    result.clear_zero();
+    return result;
+}
+
+template <typename Engine>
+BigInteger random_bits(size_t bits, Engine& engine) {
+    BigInteger bound = 1;
+
+    for (size_t i = 0; i < bits / 30; ++i) {
+        bound *= 1 << 30;
+    }
+
+    bound *= 1 << (bits % 30);
+    return random_below(bound, engine);
+}
+
+bool is_probable_prime(const BigInteger& number, int rounds = 25) {
+    if (number < 2) {
+        return false;
+    }
+
+    const std::vector<int>& primes = small_primes();
+
+    for (int prime : primes) {
+
+        if (number.remainder_small(prime) == 0) {
+            return number == prime;
+        }
+
+    }
+
+    if (number < static_cast<long long>(primes.back()) * primes.back()) {
+        return true;
+    }
+
+    BigInteger exponent = number - 1;
+    int twos = 0;
+
+    while (exponent.arr_[0] % 2 == 0) {
+        exponent /= 2;
+        ++twos;
+    }
+
+    static thread_local std::mt19937_64 engine;
+    MontgomeryContext context(number);
+    BigInteger minus_one = number - context.one();
+    BigInteger bound = number - 3;
+
+    for (int round = 0; round < rounds; ++round) {
+        BigInteger witness = round == 0 ? BigInteger(2) : random_below(bound, engine) + 2;
+        BigInteger power = context.power(context.to_montgomery(witness), exponent);
+
+        if (power == context.one() || power == minus_one) {
+            continue;
+        }
+
+        bool composite = true;
+
+        for (int i = 1; i < twos && composite; ++i) {
+            power = context.sqrmod(power);
+            composite = power != minus_one;
+        }
+
+        if (composite) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+BigInteger next_prime(const BigInteger& number) {
+    if (number < 2) {
+        return 2;
+    }
+
+    BigInteger candidate = number + 1;
+
+    if (candidate.arr_[0] % 2 == 0) {
+        candidate += 1;
+    }
+
+    const std::vector<int>& primes = small_primes();
+
+    if (candidate <= primes.back()) {
+
+        while (!is_probable_prime(candidate)) {
+            candidate += 2;
+        }
+
+        return candidate;
+    }
+
+    std::vector<int> residues(primes.size());
+
+    for (size_t i = 1; i < primes.size(); ++i) {
+        residues[i] = candidate.remainder_small(primes[i]);
+    }
+
+    for (long long offset = 0;; offset += 2) {
+        bool sieved = false;
+
+        for (size_t i = 1; i < primes.size() && !sieved; ++i) {
+            sieved = (residues[i] + offset) % primes[i] == 0;
+        }
+
+        if (!sieved && is_probable_prime(candidate + offset)) {
+            return candidate + offset;
+        }
+    }
+}
+
+BigInteger iroot(const BigInteger& number, int degree) {
+    if (degree <= 0) {
+        throw std::invalid_argument("root degree must be positive");
+    }
+
+    if (number < 0) {
+
+        if (degree % 2 == 0) {
+            throw std::domain_error("even root of a negative number");
+        }
+
+        return -iroot(-number, degree);
+    }
+
+    if (degree == 1 || number < 2) {
+        return number;
+    }
+
+    size_t size = number.arr_.size();
+    long double bits = std::log2(number.arr_[size - 1] + 1.0L) + (size - 1) * std::log2(static_cast<long double>(BigInteger::base_));
+
+    if (degree >= bits + 1) {
+        return 1;
+    }
+
+    auto power = [](BigInteger base, int exponent) {
+        BigInteger result = 1;
+
+        for (; exponent > 0; exponent /= 2) {
+
+            if (exponent % 2 == 1) {
+                result *= base;
+            }
+
+            if (exponent > 1) {
+                base *= base;
+            }
+
+        }
+
+        return result;
+    };
+
+    auto newton_step = [&](const BigInteger& root) {
+        BigInteger next = number / power(root, degree - 1);
+        addmul(next, root, BigInteger(degree - 1));
+        next /= degree;
+        return next;
+    };
+
+    size_t shift = size / (2 * degree);
+
+    if (shift < 2) {
+        size_t used = std::min<size_t>(size, 3);
+        long double top = 0;
+
+        for (size_t i = size; i > size - used; --i) {
+            top = top * BigInteger::base_ + number.arr_[i - 1];
+        }
+
+        long double estimate = std::exp((std::log(top) + (size - used) * std::log(static_cast<long double>(BigInteger::base_))) / degree);
+        char buffer[64];
+        BigInteger root;
+        from_chars(buffer, std::to_chars(buffer, buffer + sizeof(buffer), estimate * (1 + 1e-12L), std::chars_format::fixed, 0).ptr, root);
+        root += 2;
+
+        while (true) {
+            BigInteger next = newton_step(root);
+
+            if (next >= root) {
+                return root;
+            }
+
+            root = std::move(next);
+        }
+    }
+
+    --shift;
+    BigInteger root = iroot(BigInteger::limbs_slice(number, shift * degree, size), degree) + 1;
+    root.shift_limbs(shift);
+    root = newton_step(root);
+
+    while (power(root, degree) > number) {
+        --root;
+    }
+
+    return root;
+}
+
+BigInteger isqrt(const BigInteger& number) {
+    return iroot(number, 2);
+}
+
+bool is_perfect_square(const BigInteger& number) {
+    if (number < 0) {
+        return false;
+    }
+
+    if (((0x202021202030213ull >> (number.arr_[0] % 64)) & 1) == 0) {
+        return false;
+    }
+
+    int rest = number.remainder_small(63 * 65 * 11);
+
+    for (int modulus : {63, 65, 11}) {
+        bool residue = false;
+
+        for (int i = 0; i < modulus && !residue; ++i) {
+            residue = i * i % modulus == rest % modulus;
+        }
+
+        if (!residue) {
+            return false;
+        }
+    }
+
+    BigInteger root = isqrt(number);
+    return root * root == number;
+}
+
+template <typename Iterator>
+BigInteger product(Iterator first, Iterator last) {
+    auto size = std::distance(first, last);
+
+    if (size == 0) {
+        return 1;
+    }
+
+    if (size == 1) {
+        return BigInteger(1) * *first;
+    }
+
+    Iterator middle = std::next(first, size / 2);
+    return product(first, middle) * product(middle, last);
+}
+
+BigInteger range_product(unsigned long long first, unsigned long long last) {
+    static const unsigned long long word_limit = 1000000000000000000ull;
+
+    if (first == 0 && last > 0) {
+        return 0;
+    }
+
+    if (last <= first || last - first <= 32) {
+        BigInteger result = 1;
+        unsigned long long word = 1;
+
+        for (unsigned long long i = first; i < last; ++i) {
+
+            if (word > word_limit / i) {
+                result *= BigInteger(word);
+                word = 1;
+            }
+
+            word *= i;
+        }
+
+        result *= BigInteger(word);
+        return result;
+    }
+
+    unsigned long long middle = first + (last - first) / 2;
+    return range_product(first, middle) * range_product(middle, last);
+}
+
+BigInteger factorial(unsigned long long number) {
+    return number < 2 ? BigInteger(1) : range_product(2, number) * BigInteger(number);
+}
+
+BigInteger binomial(unsigned long long number, unsigned long long count) {
+    if (count > number) {
+        return 0;
+    }
+
+    count = std::min(count, number - count);
+
+    if (count == 0) {
+        return 1;
+    }
+
+    return range_product(number - count + 1, number) * BigInteger(number) / range_product(2, count + 1);
+}
+
+class Rational {
+
+private:
+    static constexpr size_t double_limbs = 4;
+    static constexpr size_t decimal_chunk = 4096;
+    static inline size_t lazy_limbs_ = 0;
+    BigInteger dividend;
+    BigInteger divisor;
+    size_t pending_ = 0;
+
+    template <typename Iterator>
+    static void sum_split(Iterator first, Iterator last, BigInteger& numerator, BigInteger& denominator) {
+        auto size = std::distance(first, last);
+
+        if (size == 1) {
+            numerator = first->dividend;
+            denominator = first->divisor;
+            return;
+        }
+
+        Iterator middle = std::next(first, size / 2);
+        BigInteger right_numerator;
+        BigInteger right_denominator;
+        sum_split(first, middle, numerator, denominator);
+        sum_split(middle, last, right_numerator, right_denominator);
+
+        if (denominator == right_denominator) {
+            numerator += right_numerator;
+            return;
+        }
+
+        numerator *= right_denominator;
+        addmul(numerator, right_numerator, denominator);
+        denominator *= right_denominator;
+    }
+
+    template <typename P, typename Q>
+    static void series_split(long long first, long long last, P& p, Q& q,
+                             BigInteger& numerator, BigInteger& denominator, BigInteger& term) {
+        if (last - first == 1) {
+            numerator = p(first);
+            denominator = q(first);
+            term = numerator;
+            return;
+        }
+
+        long long middle = first + (last - first) / 2;
+        BigInteger right_numerator;
+        BigInteger right_denominator;
+        BigInteger right_term;
+        series_split(first, middle, p, q, numerator, denominator, term);
+        series_split(middle, last, p, q, right_numerator, right_denominator, right_term);
+        term *= right_denominator;
+        addmul(term, numerator, right_term);
+        numerator *= right_numerator;
+        denominator *= right_denominator;
+    }
+
+    void reduce() {
+        BigInteger nod = gcd(dividend, divisor);
+        divexact(divisor, nod);
+        divexact(dividend, nod);
+        pending_ = 0;
+    }
+
+    bool defer(const Rational& other) {
+        size_t bound = pending_ + other.pending_ + other.dividend.arr_.size() + other.divisor.arr_.size();
+
+        if (bound <= lazy_limbs_) {
+            pending_ = bound;
+            return true;
+        }
+
+        if (pending_ != 0) {
+            reduce();
+        }
+
+        return false;
+    }
+
+    void add(const Rational& other, bool subtract) {
+        bool lazy = defer(other);
+        BigInteger nod = lazy || other.pending_ != 0 ? BigInteger(1) : gcd(divisor, other.divisor);
+
+        if (nod == 1) {
+            dividend *= other.divisor;
+            subtract ? submul(dividend, other.dividend, divisor) : addmul(dividend, other.dividend, divisor);
+            divisor *= other.divisor;
+
+            if (!lazy && other.pending_ != 0) {
+                reduce();
+            }
+        }
+
+        else {
+            BigInteger part = divisor;
+            BigInteger other_part = other.divisor;
+            divexact(part, nod);
+            divexact(other_part, nod);
+            dividend *= other_part;
+            subtract ? submul(dividend, other.dividend, part) : addmul(dividend, other.dividend, part);
+            nod = gcd(dividend, nod);
+            divexact(dividend, nod);
+            divexact(divisor, nod);
+            divisor *= other_part;
+        }
+
+        if (dividend == 0) {
+            divisor = 1;
+            pending_ = 0;
+        }
+    }
+
+    void multiply(const BigInteger& numerator, const BigInteger& denominator) {
+        if (dividend == 0 || numerator == 0) {
+            dividend = 0;
+            divisor = 1;
+            return;
+        }
+
+        BigInteger first_nod = gcd(dividend, denominator);
+        BigInteger second_nod = gcd(numerator, divisor);
+        BigInteger part = numerator;
+        BigInteger other_part = denominator;
+        divexact(dividend, first_nod);
+        divexact(divisor, second_nod);
+        divexact(part, second_nod);
+        divexact(other_part, first_nod);
+        dividend *= part;
+        divisor *= other_part;
+    }
+
+    static long long leading_product(const BigInteger& first, const BigInteger& second,
+                                     unsigned __int128& low, unsigned __int128& high) {
+        long long exponent = 0;
+        low = 1;
+        high = 1;
+
+        for (const BigInteger* number : {&first, &second}) {
+            size_t size = number->arr_.size();
+            size_t length = std::min<size_t>(size, 2);
+            unsigned long long value = 0;
+
+            for (size_t i = size; i > size - length; --i) {
+                value = value * BigInteger::base_ + number->arr_[i - 1];
+            }
+
+            low *= value;
+            high *= value + (size > length ? 1 : 0);
+            exponent += size - length;
+        }
+
+        return exponent;
+    }
+
+    std::weak_ordering compare_abs(const Rational& other) const {
+        bool zero = dividend.arr_[dividend.arr_.size() - 1] == 0;
+        bool other_zero = other.dividend.arr_[other.dividend.arr_.size() - 1] == 0;
+
+        if (zero || other_zero) {
+            return other_zero <=> zero;
+        }
+
+        if (divisor == other.divisor) {
+            return BigInteger::compare_limbs(dividend.arr_, other.dividend.arr_);
+        }
+
+        if (BigInteger::compare_limbs(dividend.arr_, other.dividend.arr_) == 0) {
+            return BigInteger::compare_limbs(other.divisor.arr_, divisor.arr_);
+        }
+
+        size_t size = dividend.arr_.size() + other.divisor.arr_.size();
+        size_t other_size = other.dividend.arr_.size() + divisor.arr_.size();
+
+        if (size > other_size + 1) {
+            return std::weak_ordering::greater;
+        }
+
+        if (other_size > size + 1) {
+            return std::weak_ordering::less;
+        }
+
+        unsigned __int128 low;
+        unsigned __int128 high;
+        unsigned __int128 other_low;
+        unsigned __int128 other_high;
+        long long shift = leading_product(dividend, other.divisor, low, high) -
+                          leading_product(other.dividend, divisor, other_low, other_high);
+
+        for (; shift > 0; --shift) {
+            other_low /= BigInteger::base_;
+            other_high = (other_high + BigInteger::base_ - 1) / BigInteger::base_;
+        }
+
+        for (; shift < 0; ++shift) {
+            low /= BigInteger::base_;
+            high = (high + BigInteger::base_ - 1) / BigInteger::base_;
+        }
+
+        if (low > other_high) {
+            return std::weak_ordering::greater;
+        }
+
+        if (high < other_low) {
+            return std::weak_ordering::less;
+        }
+
+        return BigInteger::compare_limbs((dividend * other.divisor).arr_, (other.dividend * divisor).arr_);
+    }
+
+    static BigInteger power_of_two(size_t exponent) {
+        BigInteger result = 1;
+
+        for (; exponent >= 29; exponent -= 29) {
+            result.mul_small(1 << 29);
+        }
+
+        result.mul_small(1 << exponent);
+        return result;
+    }
+
+    static double to_double(const BigInteger& first, const BigInteger& second, long long limbs) {
+        if (first == 0) {
+            return 0;
+        }
+
+        static const double limb_bits = std::log2(static_cast<double>(BigInteger::base_));
+
+        auto estimate = [](const BigInteger& number) {
+            size_t size = number.arr_.size();
+            double top = number.arr_[size - 1];
+
+            if (size > 1) {
+                top = top * BigInteger::base_ + number.arr_[size - 2];
+            }
+
+            return std::log2(top) + static_cast<double>(size - std::min<size_t>(size, 2)) * limb_bits;
+        };
+
+        long long exponent = std::floor(estimate(first) - estimate(second) + static_cast<double>(limbs) * limb_bits);
+
+        if (exponent > 1026) {
+            return std::numeric_limits<double>::infinity();
+        }
+
+        if (exponent < -1080) {
+            return 0;
+        }
+
+        long long shift = std::max(exponent - 64, -1076ll);
+        BigInteger numerator = first;
+        BigInteger denominator = second;
+
+        if (limbs > 0) {
+            numerator.shift_limbs(limbs);
+        }
+
+        else {
+            denominator.shift_limbs(-limbs);
+        }
+
+        if (shift < 0) {
+            numerator *= power_of_two(-shift);
+        }
+
+        else {
+            denominator *= power_of_two(shift);
+        }
+
+        BigInteger quotient;
+        BigInteger remainder;
+        BigInteger::divide_abs(numerator, denominator, quotient, remainder);
+        unsigned __int128 value = 0;
+
+        for (size_t i = quotient.arr_.size(); i > 0; --i) {
+            value = value * BigInteger::base_ + quotient.arr_[i - 1];
+        }
+
+        int bits = 128 - (value >> 64 != 0 ? std::countl_zero(static_cast<unsigned long long>(value >> 64))
+                                            : 64 + std::countl_zero(static_cast<unsigned long long>(value)));
+        long long drop = std::max(bits - 53ll, -1074 - shift);
+        unsigned __int128 kept = value >> drop;
+        unsigned __int128 rest = value & ((static_cast<unsigned __int128>(1) << drop) - 1);
+        unsigned __int128 half = static_cast<unsigned __int128>(1) << (drop - 1);
+
+        if (rest > half || (rest == half && (remainder != 0 || (kept & 1) != 0))) {
+            ++kept;
+        }
+
+        return std::ldexp(static_cast<double>(static_cast<unsigned long long>(kept)), shift + drop);
+    }
+
+    template <typename Iterator>
+    friend Rational sum(Iterator first, Iterator last);
+    template <typename P, typename Q>
+    friend Rational series_sum(long long first, long long last, P p, Q q);
+
+public:
+
+    Rational() = default;
+
+    Rational(const BigInteger& first, const BigInteger& second) {
+        dividend = first;
+        divisor = second;
+
+        if (!static_cast<bool>(divisor.sign_)) {
+            divisor.sign_ = (static_cast<bool>(divisor.sign_)) ? Sign::negative : Sign::positive;
+            dividend.sign_ = (static_cast<bool>(dividend.sign_)) ? Sign::negative : Sign::positive;
+        }
+
+        reduce();
+    }
+
+    Rational(const BigInteger& number) {
+        dividend = number;
+        divisor = 1;
+    }
+
+    Rational(int number) {
+        dividend = number;
+        divisor = 1;
+    }
+
+    static void set_lazy_limbs(size_t limbs) {
+        lazy_limbs_ = limbs;
+    }
+
+    static size_t lazy_limbs() {
+        return lazy_limbs_;
+    }
+
+    Rational& operator+=(const Rational& other) {
+        if (this == &other) {
+            dividend *= 2;
+
+            if (++pending_ > lazy_limbs_) {
+                reduce();
+            }
+
+            return *this;
+        }
+
+        add(other, false);
+        return *this;
+    }
+
+    Rational& operator-=(const Rational& other) {
+        if (this == &other) {
+            return *this = 0;
+        }
+
+        add(other, true);
+        return *this;
+    }
+
+    Rational& operator*=(const Rational& other) {
+        if (this == &other) {
+            dividend *= other.dividend;
+            divisor *= other.divisor;
+            pending_ *= 2;
+
+            if (pending_ > lazy_limbs_) {
+                reduce();
+            }
+
+            return *this;
+        }
+
+        bool lazy = defer(other);
+
+        if (!lazy && other.pending_ == 0) {
+            multiply(other.dividend, other.divisor);
+        }
+
+        else {
+            dividend *= other.dividend;
+            divisor *= other.divisor;
+
+            if (!lazy) {
+                reduce();
+            }
+        }
+
+        return *this;
+    }
+
+    Rational& operator/=(const Rational& other) {
+        if (this == &other) {
+            return *this = 1;
+        }
+
+        bool lazy = defer(other);
+
+        if (!lazy && other.pending_ == 0) {
+            multiply(other.divisor, other.dividend);
+        }
+
+        else {
+            dividend *= other.divisor;
+            divisor *= other.dividend;
+
+            if (!lazy) {
+                reduce();
+            }
+        }
+
+        if (divisor < 0) {
+
+            divisor.sign_ = Sign::positive;
+
+            if (dividend != 0) {
+                dividend.sign_ = (static_cast<bool>(dividend.sign_)) ? Sign::negative : Sign::positive;
+            }
+
+        }
+
+        return *this;
+    }
+
+    Rational operator-() const {
+        Rational result = *this;
+        result.dividend *= -1;
+        return result;
+    }
+
+    std::weak_ordering operator<=>(const Rational& other) const {
+        if (dividend.sign_ != other.dividend.sign_) {
+            return dividend.sign_ <=> other.dividend.sign_;
+        }
+
+        std::weak_ordering order = compare_abs(other);
+        return static_cast<bool>(dividend.sign_) ? order : 0 <=> order;
+    }
+
+    bool operator==(const Rational& other) const {
+        if (pending_ != 0 || other.pending_ != 0) {
+            return dividend.sign_ == other.dividend.sign_ && compare_abs(other) == 0;
+        }
+
+        return dividend == other.dividend && divisor == other.divisor;
+    }
+
+    std::string toString() const {
+        if (pending_ != 0) {
+            Rational copy = *this;
+            copy.reduce();
+            return copy.toString();
+        }
+
         std::string str = dividend.toString();
 
-        if (divisor == 1 || dividend == 0) {
-            return str;
+        if (divisor == 1 || dividend == 0) {
+            return str;
+        }
+
+        str += '/';
+        str += divisor.toString();
+        return str;
+    }
+
+    template <typename Function>
+    void writeDecimal(size_t precision, Function write) const {
+        if (pending_ != 0) {
+            Rational copy = *this;
+            copy.reduce();
+            copy.writeDecimal(precision, write);
+            return;
+        }
+
+        static const int powers[BigInteger::nine_] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+        bool integral = divisor == 1;
+        size_t limbs = integral ? 0 : precision / BigInteger::nine_;
+        int digits = integral ? 0 : precision % BigInteger::nine_;
+        BigInteger quotient = dividend;
+        quotient.sign_ = Sign::positive;
+
+        if (!integral) {
+            quotient.shift_limbs(limbs);
+            quotient.mul_small(powers[digits]);
+            quotient /= divisor;
+        }
+
+        BigInteger integer = BigInteger::limbs_slice(quotient, limbs, quotient.arr_.size());
+        int low = digits != 0 ? integer.divmod_small(powers[digits]) : 0;
+        char chunk[decimal_chunk];
+        size_t used = 0;
+
+        auto put = [&](int limb, int width) {
+            if (used + BigInteger::nine_ + 1 > decimal_chunk) {
+                write(static_cast<const char*>(chunk), used);
+                used = 0;
+            }
+
+            if (width == 0) {
+                used = std::to_chars(chunk + used, chunk + decimal_chunk, limb).ptr - chunk;
+                return;
+            }
+
+            for (int j = width - 1; j >= 0; --j) {
+                chunk[used + j] = static_cast<char>('0' + limb % 10);
+                limb /= 10;
+            }
+
+            used += width;
+        };
+
+        if (!static_cast<bool>(dividend.sign_)) {
+            chunk[used++] = '-';
+        }
+
+        put(integer.arr_[integer.arr_.size() - 1], 0);
+
+        for (size_t i = integer.arr_.size() - 1; i > 0; --i) {
+            put(integer.arr_[i - 1], BigInteger::nine_);
+        }
+
+        if (!integral) {
+            chunk[used++] = '.';
+
+            if (digits != 0) {
+                put(low, digits);
+            }
+
+            for (size_t i = limbs; i > 0; --i) {
+                put(i - 1 < quotient.arr_.size() ? quotient.arr_[i - 1] : 0, BigInteger::nine_);
+            }
+        }
+
+        write(static_cast<const char*>(chunk), used);
+    }
+
+    void writeDecimal(std::ostream& out, size_t precision = 0) const {
+        writeDecimal(precision, [&out](const char* data, size_t size) {
+            out.write(data, size);
+        });
+    }
+
+    std::string asDecimal(size_t precision = 0) const {
+        std::string str;
+
+        writeDecimal(precision, [&str](const char* data, size_t size) {
+            str.append(data, size);
+        });
+
+        return str;
+    }
+
+    static Rational from_double(double value) {
+        if (!std::isfinite(value)) {
+            throw std::domain_error("Rational cannot represent NaN or infinity");
+        }
+
+        unsigned long long bits = std::bit_cast<unsigned long long>(value);
+        unsigned long long mantissa = bits & ((1ull << 52) - 1);
+        int exponent = static_cast<int>(bits >> 52 & 0x7ff);
+
+        if (exponent == 0) {
+            exponent = 1;
+        }
+
+        else {
+            mantissa |= 1ull << 52;
+        }
+
+        if (mantissa == 0) {
+            return 0;
+        }
+
+        exponent -= 1075;
+
+        if (exponent < 0) {
+            int shift = std::min(std::countr_zero(mantissa), -exponent);
+            mantissa >>= shift;
+            exponent += shift;
+        }
+
+        Rational result;
+        result.dividend = BigInteger(mantissa);
+        result.divisor = 1;
+
+        if (exponent > 0) {
+            result.dividend *= power_of_two(exponent);
+        }
+
+        else {
+            result.divisor = power_of_two(-exponent);
+        }
+
+        if (bits >> 63 != 0) {
+            result.dividend.sign_ = Sign::negative;
+        }
+
+        return result;
+    }
+
+    explicit operator double() const {
+        size_t size = dividend.arr_.size();
+        size_t other_size = divisor.arr_.size();
+        BigInteger numerator = BigInteger::limbs_slice(dividend, size - std::min(size, double_limbs), size);
+        BigInteger denominator = BigInteger::limbs_slice(divisor, other_size - std::min(other_size, double_limbs), other_size);
+        double result;
+
+        if (size <= double_limbs && other_size <= double_limbs) {
+            result = to_double(numerator, denominator, 0);
+        }
+
+        else {
+            long long limbs = static_cast<long long>(size - numerator.arr_.size()) -
+                              static_cast<long long>(other_size - denominator.arr_.size());
+            double low = to_double(numerator, other_size > double_limbs ? denominator + 1 : denominator, limbs);
+            double high = to_double(size > double_limbs ? numerator + 1 : numerator, denominator, limbs);
+            result = low == high ? low : to_double(BigInteger::limbs_slice(dividend, 0, size), divisor, 0);
+        }
+
+        return static_cast<bool>(dividend.sign_) ? result : -result;
+    }
+
+    ~Rational() = default;
+};
+
+Rational operator+(Rational first, const Rational& second) {
+    first += second;
+    return first;
+}
+
+Rational operator+(const Rational& first, Rational&& second) {
+    second += first;
+    return std::move(second);
+}
+
+Rational operator-(Rational first, const Rational& second) {
+    first -= second;
+    return first;
+}
+
+Rational operator*(Rational first, const Rational& second) {
+    first *= second;
+    return first;
+}
+
+Rational operator*(const Rational& first, Rational&& second) {
+    second *= first;
+    return std::move(second);
+}
+
+Rational operator/(Rational first, const Rational& second) {
+    first /= second;
+    return first;
+}
+
+template <typename Iterator>
+Rational sum(Iterator first, Iterator last) {
+    if (first == last) {
+        return 0;
+    }
+
+    BigInteger numerator;
+    BigInteger denominator;
+    Rational::sum_split(first, last, numerator, denominator);
+    return Rational(numerator, denominator);
+}
+
+template <typename P, typename Q>
+Rational series_sum(long long first, long long last, P p, Q q) {
+    if (first >= last) {
+        return 0;
+    }
+
+    BigInteger numerator;
+    BigInteger denominator;
+    BigInteger term;
+    Rational::series_split(first, last, p, q, numerator, denominator, term);
+    return Rational(term, denominator);
+}
+
+template <size_t Bits, bool Signed>
+class BasicFixedInt {
+private:
+    static_assert(Bits > 0 && Bits % 64 == 0, "FixedInt width must be a positive multiple of 64 bits");
+
+    using limb = unsigned long long;
+    using wide = unsigned __int128;
+
+    static constexpr int bits_ = 64;
+    static constexpr size_t limbs_ = Bits / bits_;
+    static constexpr int decimal_digits_ = 19;
+    static constexpr limb decimal_base_ = 10000000000000000000ull;
+    limb arr_[limbs_] = {};
+
+    template <size_t OtherBits, bool OtherSigned>
+    friend class BasicFixedInt;
+
+    template <typename Body>
+    static constexpr void unroll(Body body) {
+        [&]<size_t... Index>(std::index_sequence<Index...>) {
+            (body.template operator()<Index>(), ...);
+        }(std::make_index_sequence<limbs_>());
+    }
+
+    constexpr bool is_negative() const {
+        if constexpr (Signed) {
+            return (arr_[limbs_ - 1] >> (bits_ - 1)) != 0;
+        }
+
+        return false;
+    }
+
+    constexpr bool is_zero() const {
+        limb bits = 0;
+        unroll([&]<size_t i>() { bits |= arr_[i]; });
+        return bits == 0;
+    }
+
+    constexpr size_t used_limbs() const {
+        size_t size = limbs_;
+
+        while (size > 0 && arr_[size - 1] == 0) {
+            --size;
+        }
+
+        return size;
+    }
+
+    constexpr void negate() {
+        limb carry = 1;
+
+        unroll([&]<size_t i>() {
+            wide sum = static_cast<wide>(~arr_[i]) + carry;
+            arr_[i] = static_cast<limb>(sum);
+            carry = static_cast<limb>(sum >> bits_);
+        });
+    }
+
+    constexpr BasicFixedInt magnitude() const {
+        BasicFixedInt result = *this;
+
+        if (is_negative()) {
+            result.negate();
+        }
+
+        return result;
+    }
+
+    constexpr limb divide_small(limb divisor) {
+        wide rest = 0;
+
+        for (size_t i = limbs_; i > 0; --i) {
+            wide value = (rest << bits_) | arr_[i - 1];
+            arr_[i - 1] = static_cast<limb>(value / divisor);
+            rest = value % divisor;
+        }
+
+        return static_cast<limb>(rest);
+    }
+
+    constexpr limb multiply_small(limb factor, limb addend) {
+        limb carry = addend;
+
+        unroll([&]<size_t i>() {
+            wide product = static_cast<wide>(arr_[i]) * factor + carry;
+            arr_[i] = static_cast<limb>(product);
+            carry = static_cast<limb>(product >> bits_);
+        });
+
+        return carry;
+    }
+
+    static constexpr void divide_magnitude(const BasicFixedInt& first, const BasicFixedInt& second,
+                                           BasicFixedInt& quotient, BasicFixedInt& remainder) {
+        size_t first_size = first.used_limbs();
+        size_t size = second.used_limbs();
+
+        if (size == 0) {
+            throw std::domain_error("FixedInt division by zero");
+        }
+
+        quotient = 0;
+        remainder = 0;
+
+        if (first_size < size) {
+            remainder = first;
+            return;
+        }
+
+        if (size == 1) {
+            quotient = first;
+            remainder = quotient.divide_small(second.arr_[0]);
+            return;
+        }
+
+        int shift = std::countl_zero(second.arr_[size - 1]);
+        limb divisor[limbs_] = {};
+        limb dividend[limbs_ + 1] = {};
+
+        for (size_t i = size; i > 0; --i) {
+            divisor[i - 1] = second.arr_[i - 1] << shift;
+
+            if (shift != 0 && i > 1) {
+                divisor[i - 1] |= second.arr_[i - 2] >> (bits_ - shift);
+            }
+        }
+
+        for (size_t i = first_size; i > 0; --i) {
+            dividend[i] |= shift != 0 ? first.arr_[i - 1] >> (bits_ - shift) : 0;
+            dividend[i - 1] = first.arr_[i - 1] << shift;
+        }
+
+        for (size_t j = first_size - size + 1; j > 0; --j) {
+            limb* window = dividend + j - 1;
+            wide number = (static_cast<wide>(window[size]) << bits_) | window[size - 1];
+            wide estimate = number / divisor[size - 1];
+            wide rest = number % divisor[size - 1];
+
+            while ((estimate >> bits_) != 0 ||
+                   estimate * divisor[size - 2] > ((rest << bits_) | window[size - 2])) {
+                --estimate;
+                rest += divisor[size - 1];
+
+                if ((rest >> bits_) != 0) {
+                    break;
+                }
+            }
+
+            limb borrow = 0;
+            limb carry = 0;
+
+            for (size_t i = 0; i < size; ++i) {
+                wide product = estimate * divisor[i] + carry;
+                carry = static_cast<limb>(product >> bits_);
+                wide difference = static_cast<wide>(window[i]) - static_cast<limb>(product) - borrow;
+                window[i] = static_cast<limb>(difference);
+                borrow = (difference >> bits_) != 0 ? 1 : 0;
+            }
+
+            wide difference = static_cast<wide>(window[size]) - carry - borrow;
+            window[size] = static_cast<limb>(difference);
+
+            if ((difference >> bits_) != 0) {
+                --estimate;
+                limb add_carry = 0;
+
+                for (size_t i = 0; i < size; ++i) {
+                    wide sum = static_cast<wide>(window[i]) + divisor[i] + add_carry;
+                    window[i] = static_cast<limb>(sum);
+                    add_carry = static_cast<limb>(sum >> bits_);
+                }
+
+                window[size] += add_carry;
+            }
+
+            quotient.arr_[j - 1] = static_cast<limb>(estimate);
+        }
+
+        for (size_t i = 0; i < size; ++i) {
+            remainder.arr_[i] = dividend[i] >> shift;
+
+            if (shift != 0) {
+                remainder.arr_[i] |= dividend[i + 1] << (bits_ - shift);
+            }
+        }
+    }
+
+    constexpr void divide(const BasicFixedInt& other, bool keep_remainder) {
+        BasicFixedInt quotient;
+        BasicFixedInt remainder;
+        divide_magnitude(magnitude(), other.magnitude(), quotient, remainder);
+
+        if (keep_remainder) {
+            if (is_negative()) {
+                remainder.negate();
+            }
+
+            *this = remainder;
+        }
+
+        else {
+            if (is_negative() != other.is_negative()) {
+                quotient.negate();
+            }
+
+            *this = quotient;
+        }
+    }
+
+public:
+
+    constexpr BasicFixedInt() = default;
+
+    template <typename Integer> requires std::is_integral_v<Integer>
+    constexpr BasicFixedInt(Integer number) {
+        arr_[0] = static_cast<limb>(number);
+
+        if constexpr (std::is_signed_v<Integer>) {
+            for (size_t i = 1; i < limbs_ && number < 0; ++i) {
+                arr_[i] = ~limb(0);
+            }
+        }
+    }
+
+    template <size_t OtherBits, bool OtherSigned>
+    constexpr explicit BasicFixedInt(const BasicFixedInt<OtherBits, OtherSigned>& other) {
+        limb fill = other.is_negative() ? ~limb(0) : 0;
+
+        unroll([&]<size_t i>() {
+            if constexpr (i < BasicFixedInt<OtherBits, OtherSigned>::limbs_) {
+                arr_[i] = other.arr_[i];
+            }
+
+            else {
+                arr_[i] = fill;
+            }
+        });
+    }
+
+    template <typename Alloc>
+    explicit BasicFixedInt(const BasicBigInteger<Alloc>& number) {
+        for (size_t i = number.arr_.size(); i > 0; --i) {
+            multiply_small(BasicBigInteger<Alloc>::base_, number.arr_[i - 1]);
+        }
+
+        if (!static_cast<bool>(number.sign_)) {
+            negate();
+        }
+    }
+
+    static constexpr BasicFixedInt min() {
+        BasicFixedInt result;
+
+        if constexpr (Signed) {
+            result.arr_[limbs_ - 1] = limb(1) << (bits_ - 1);
+        }
+
+        return result;
+    }
+
+    static constexpr BasicFixedInt max() {
+        BasicFixedInt result = ~BasicFixedInt();
+
+        if constexpr (Signed) {
+            result.arr_[limbs_ - 1] >>= 1;
+        }
+
+        return result;
+    }
+
+    constexpr BasicFixedInt& operator+=(const BasicFixedInt& other) {
+        limb carry = 0;
+
+        unroll([&]<size_t i>() {
+            wide sum = static_cast<wide>(arr_[i]) + other.arr_[i] + carry;
+            arr_[i] = static_cast<limb>(sum);
+            carry = static_cast<limb>(sum >> bits_);
+        });
+
+        return *this;
+    }
+
+    constexpr BasicFixedInt& operator-=(const BasicFixedInt& other) {
+        limb borrow = 0;
+
+        unroll([&]<size_t i>() {
+            wide difference = static_cast<wide>(arr_[i]) - other.arr_[i] - borrow;
+            arr_[i] = static_cast<limb>(difference);
+            borrow = (difference >> bits_) != 0 ? 1 : 0;
+        });
+
+        return *this;
+    }
+
+    constexpr BasicFixedInt& operator*=(const BasicFixedInt& other) {
+        limb result[limbs_] = {};
+
+        unroll([&]<size_t i>() {
+            limb carry = 0;
+
+            unroll([&]<size_t j>() {
+                if constexpr (i + j < limbs_) {
+                    wide product = static_cast<wide>(arr_[i]) * other.arr_[j] + result[i + j] + carry;
+                    result[i + j] = static_cast<limb>(product);
+                    carry = static_cast<limb>(product >> bits_);
+                }
+            });
+        });
+
+        std::copy(result, result + limbs_, arr_);
+        return *this;
+    }
+
+    constexpr BasicFixedInt& operator/=(const BasicFixedInt& other) {
+        divide(other, false);
+        return *this;
+    }
+
+    constexpr BasicFixedInt& operator%=(const BasicFixedInt& other) {
+        divide(other, true);
+        return *this;
+    }
+
+    constexpr BasicFixedInt& operator&=(const BasicFixedInt& other) {
+        unroll([&]<size_t i>() { arr_[i] &= other.arr_[i]; });
+        return *this;
+    }
+
+    constexpr BasicFixedInt& operator|=(const BasicFixedInt& other) {
+        unroll([&]<size_t i>() { arr_[i] |= other.arr_[i]; });
+        return *this;
+    }
+
+    constexpr BasicFixedInt& operator^=(const BasicFixedInt& other) {
+        unroll([&]<size_t i>() { arr_[i] ^= other.arr_[i]; });
+        return *this;
+    }
+
+    constexpr BasicFixedInt& operator<<=(size_t shift) {
+        size_t words = shift / bits_;
+        int bits = shift % bits_;
+
+        for (size_t i = limbs_; i > 0; --i) {
+            limb value = 0;
+
+            if (i - 1 >= words) {
+                value = arr_[i - 1 - words] << bits;
+
+                if (bits != 0 && i - 1 > words) {
+                    value |= arr_[i - 2 - words] >> (bits_ - bits);
+                }
+            }
+
+            arr_[i - 1] = value;
+        }
+
+        return *this;
+    }
+
+    constexpr BasicFixedInt& operator>>=(size_t shift) {
+        limb fill = is_negative() ? ~limb(0) : 0;
+        size_t words = shift / bits_;
+        int bits = shift % bits_;
+
+        for (size_t i = 0; i < limbs_; ++i) {
+            limb low = i + words < limbs_ ? arr_[i + words] : fill;
+            limb high = i + words + 1 < limbs_ ? arr_[i + words + 1] : fill;
+            arr_[i] = bits == 0 ? low : (low >> bits) | (high << (bits_ - bits));
+        }
+
+        return *this;
+    }
+
+    constexpr BasicFixedInt operator~() const {
+        BasicFixedInt result;
+        unroll([&]<size_t i>() { result.arr_[i] = ~arr_[i]; });
+        return result;
+    }
+
+    constexpr BasicFixedInt operator-() const {
+        BasicFixedInt result = *this;
+        result.negate();
+        return result;
+    }
+
+    constexpr BasicFixedInt& operator++() {
+        *this += 1;
+        return *this;
+    }
+
+    constexpr BasicFixedInt operator++(int) {
+        BasicFixedInt result = *this;
+        ++(*this);
+        return result;
+    }
+
+    constexpr BasicFixedInt& operator--() {
+        *this -= 1;
+        return *this;
+    }
+
+    constexpr BasicFixedInt operator--(int) {
+        BasicFixedInt result = *this;
+        --(*this);
+        return result;
+    }
+
+    constexpr explicit operator bool() const { return !is_zero(); }
+
+    template <typename Integer> requires (std::is_integral_v<Integer> && !std::is_same_v<Integer, bool>)
+    constexpr explicit operator Integer() const {
+        return static_cast<Integer>(arr_[0]);
+    }
+
+    template <typename Alloc>
+    explicit operator BasicBigInteger<Alloc>() const {
+        const limb base = BasicBigInteger<Alloc>::base_;
+        BasicBigInteger<Alloc> result;
+        BasicFixedInt value = magnitude();
+        result.arr_.clear();
+
+        do {
+            limb rest = value.divide_small(base * base);
+            result.arr_.push_back(rest % base);
+            result.arr_.push_back(rest / base);
+        } while (!value.is_zero());
+
+        result.clear_zero();
+        result.sign_ = is_negative() ? Sign::negative : Sign::positive;
+        return result;
+    }
+
+    std::string toString() const {
+        std::string str(Bits / 3 + 3, '0');
+        str.resize(to_chars(str.data(), str.data() + str.size(), *this).ptr - str.data());
+        return str;
+    }
+
+    friend constexpr BasicFixedInt operator+(BasicFixedInt first, const BasicFixedInt& second) {
+        first += second;
+        return first;
+    }
+
+    friend constexpr BasicFixedInt operator-(BasicFixedInt first, const BasicFixedInt& second) {
+        first -= second;
+        return first;
+    }
+
+    friend constexpr BasicFixedInt operator*(BasicFixedInt first, const BasicFixedInt& second) {
+        first *= second;
+        return first;
+    }
+
+    friend constexpr BasicFixedInt operator/(BasicFixedInt first, const BasicFixedInt& second) {
+        first /= second;
+        return first;
+    }
+
+    friend constexpr BasicFixedInt operator%(BasicFixedInt first, const BasicFixedInt& second) {
+        first %= second;
+        return first;
+    }
+
+    friend constexpr BasicFixedInt operator&(BasicFixedInt first, const BasicFixedInt& second) {
+        first &= second;
+        return first;
+    }
+
+    friend constexpr BasicFixedInt operator|(BasicFixedInt first, const BasicFixedInt& second) {
+        first |= second;
+        return first;
+    }
+
+    friend constexpr BasicFixedInt operator^(BasicFixedInt first, const BasicFixedInt& second) {
+        first ^= second;
+        return first;
+    }
+
+    friend constexpr BasicFixedInt operator<<(BasicFixedInt number, size_t shift) {
+        number <<= shift;
+        return number;
+    }
+
+    friend constexpr BasicFixedInt operator>>(BasicFixedInt number, size_t shift) {
+        number >>= shift;
+        return number;
+    }
+
+    friend constexpr bool operator==(const BasicFixedInt& first, const BasicFixedInt& second) = default;
+
+    friend constexpr std::strong_ordering operator<=>(const BasicFixedInt& first, const BasicFixedInt& second) {
+        if (first.is_negative() != second.is_negative()) {
+            return first.is_negative() ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+
+        for (size_t i = limbs_; i > 0; --i) {
+
+            if (first.arr_[i - 1] != second.arr_[i - 1]) {
+                return first.arr_[i - 1] <=> second.arr_[i - 1];
+            }
+
+        }
+
+        return std::strong_ordering::equal;
+    }
+
+    friend std::to_chars_result to_chars(char* first, char* last, const BasicFixedInt& number) {
+        limb chunks[Bits / (bits_ - 1) + 1];
+        size_t count = 0;
+        BasicFixedInt value = number.magnitude();
+
+        do {
+            chunks[count++] = value.divide_small(decimal_base_);
+        } while (!value.is_zero());
+
+        char top[decimal_digits_ + 1];
+        size_t top_size = std::to_chars(top, top + sizeof(top), chunks[count - 1]).ptr - top;
+        size_t size = (number.is_negative() ? 1 : 0) + top_size + (count - 1) * decimal_digits_;
+
+        if (static_cast<size_t>(last - first) < size) {
+            return {last, std::errc::value_too_large};
+        }
+
+        if (number.is_negative()) {
+            *first++ = '-';
+        }
+
+        first = std::copy(top, top + top_size, first);
+
+        for (size_t i = count - 1; i > 0; --i) {
+            limb chunk = chunks[i - 1];
+
+            for (int j = decimal_digits_ - 1; j >= 0; --j) {
+                first[j] = static_cast<char>('0' + chunk % 10);
+                chunk /= 10;
+            }
+
+            first += decimal_digits_;
+        }
+
+        return {first, std::errc()};
+    }
+
+    friend std::from_chars_result from_chars(const char* first, const char* last, BasicFixedInt& number) {
+        const char* begin = first;
+        bool negative = false;
+
+        if (Signed && begin != last && *begin == '-') {
+            negative = true;
+            ++begin;
+        }
+
+        const char* end = begin;
+
+        while (end != last && *end >= '0' && *end <= '9') {
+            ++end;
+        }
+
+        if (begin == end) {
+            return {first, std::errc::invalid_argument};
+        }
+
+        BasicFixedInt value;
+        bool overflow = false;
+
+        for (const char* chunk = begin; chunk != end;) {
+            const char* chunk_end = chunk + std::min<size_t>(decimal_digits_, end - chunk);
+            limb part = 0;
+            limb scale = 1;
+
+            for (; chunk != chunk_end; ++chunk) {
+                part = part * 10 + (*chunk - '0');
+                scale *= 10;
+            }
+
+            overflow |= value.multiply_small(scale, part) != 0;
+        }
+
+        if (Signed && value.is_negative() && !(negative && value == min())) {
+            overflow = true;
+        }
+
+        if (overflow) {
+            return {end, std::errc::result_out_of_range};
+        }
+
+        if (negative) {
+            value.negate();
+        }
+
+        number = value;
+        return {end, std::errc()};
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const BasicFixedInt& number) {
+        char buffer[Bits / 3 + 3];
+        return out << std::string_view(buffer, to_chars(buffer, buffer + sizeof(buffer), number).ptr - buffer);
+    }
+
+    friend std::istream& operator>>(std::istream& in, BasicFixedInt& number) {
+        std::string str;
+        in >> str;
+        std::from_chars_result result = from_chars(str.data(), str.data() + str.size(), number);
+
+        if (result.ec != std::errc() || result.ptr != str.data() + str.size()) {
+            in.setstate(std::ios::failbit);
+        }
+
+        return in;
+    }
+};
+
+template <size_t Bits>
+using FixedInt = BasicFixedInt<Bits, true>;
+
+template <size_t Bits>
+using FixedUInt = BasicFixedInt<Bits, false>;
+
+template <typename Fixed, typename Alloc>
+Fixed checked_cast(const BasicBigInteger<Alloc>& number) {
+    static const BasicBigInteger<Alloc> minimum(Fixed::min());
+    static const BasicBigInteger<Alloc> maximum(Fixed::max());
+
+    if (number < minimum || number > maximum) {
+        throw std::overflow_error("BigInteger does not fit the fixed width");
+    }
+
+    return Fixed(number);
+}
+
+template <typename Fixed, typename Alloc>
+Fixed saturating_cast(const BasicBigInteger<Alloc>& number) {
+    static const BasicBigInteger<Alloc> minimum(Fixed::min());
+    static const BasicBigInteger<Alloc> maximum(Fixed::max());
+
+    if (number < minimum) {
+        return Fixed::min();
+    }
+
+    if (number > maximum) {
+        return Fixed::max();
+    }
+
+    return Fixed(number);
+}
+
+template <size_t Bits>
+constexpr FixedUInt<Bits> mulmod(const FixedUInt<Bits>& first, const FixedUInt<Bits>& second, const FixedUInt<Bits>& mod) {
+    using Wide = FixedUInt<2 * Bits>;
+    return FixedUInt<Bits>(Wide(first) * Wide(second) % Wide(mod));
+}
+
+template <size_t Bits>
+constexpr FixedUInt<Bits> powmod(FixedUInt<Bits> base, FixedUInt<Bits> exponent, const FixedUInt<Bits>& mod) {
+    FixedUInt<Bits> result = FixedUInt<Bits>(1) % mod;
+    base %= mod;
+
+    while (exponent) {
+        if ((exponent & 1) != 0) {
+            result = mulmod(result, base, mod);
+        }
+
+        base = mulmod(base, base, mod);
+        exponent >>= 1;
+    }
+
+    return result;
+}
+
+
+class BinaryBigInteger {
+private:
+    using limb = unsigned long long;
+    using wide = unsigned __int128;
+
+    static constexpr int bits_ = 64;
+    static constexpr int decimal_digits_ = 19;
+    static constexpr limb decimal_base_ = 10000000000000000000ull;
+    Sign sign_;
+    std::vector<limb> arr_;
+
+    friend std::istream& operator>>(std::istream& in, BinaryBigInteger& number);
+    friend std::ostream& operator<<(std::ostream& out, const BinaryBigInteger& number);
+
+    void clear_zero() {
+        while (arr_.back() == 0 && arr_.size() > 1) {
+            arr_.pop_back();
+        }
+
+        if (arr_.back() == 0) {
+            sign_ = Sign::positive;
+        }
+    }
+
+    static std::weak_ordering compare_limbs(const std::vector<limb>& first, const std::vector<limb>& second) {
+        if (first.size() != second.size()) {
+            return first.size() <=> second.size();
+        }
+
+        for (size_t i = first.size(); i > 0; --i) {
+
+            if (first[i - 1] != second[i - 1]) {
+                return first[i - 1] <=> second[i - 1];
+            }
+
+        }
+
+        return std::weak_ordering::equivalent;
+    }
+
+    static limb add_limbs(limb* first, size_t first_size, const limb* second, size_t second_size) {
+        limb carry = 0;
+
+        for (size_t i = 0; i < first_size && (i < second_size || carry != 0); ++i) {
+            wide sum = static_cast<wide>(first[i]) + (i < second_size ? second[i] : 0) + carry;
+            first[i] = static_cast<limb>(sum);
+            carry = static_cast<limb>(sum >> bits_);
+        }
+
+        return carry;
+    }
+
+    static void sub_limbs(limb* first, size_t first_size, const limb* second, size_t second_size) {
+        limb borrow = 0;
+
+        for (size_t i = 0; i < first_size && (i < second_size || borrow != 0); ++i) {
+            limb value = i < second_size ? second[i] : 0;
+            limb difference = first[i] - value - borrow;
+            borrow = (first[i] < value || first[i] - value < borrow) ? 1 : 0;
+            first[i] = difference;
+        }
+    }
+
+    static void mul_basecase(const limb* first, size_t first_size, const limb* second, size_t second_size, limb* result) {
+        std::fill(result, result + first_size + second_size, 0);
+
+        for (size_t i = 0; i < first_size; ++i) {
+            limb carry = 0;
+
+            for (size_t j = 0; j < second_size; ++j) {
+                wide product = static_cast<wide>(first[i]) * second[j] + result[i + j] + carry;
+                result[i + j] = static_cast<limb>(product);
+                carry = static_cast<limb>(product >> bits_);
+            }
+
+            result[i + second_size] = carry;
+        }
+    }
+
+    static void mul_karatsuba(const limb* first, size_t first_size, const limb* second, size_t second_size, limb* result) {
+        size_t half = (first_size + 1) / 2;
+        size_t high_first = first_size - half;
+        size_t high_second = second_size > half ? second_size - half : 0;
+        size_t low_second = second_size - high_second;
+
+        std::vector<limb> low(2 * half);
+        std::vector<limb> high(high_first + high_second);
+        multiply_limbs(first, half, second, low_second, low.data());
+        multiply_limbs(first + half, high_first, second + half, high_second, high.data());
+
+        std::vector<limb> first_sum(first, first + half);
+        std::vector<limb> second_sum(second, second + low_second);
+        first_sum.resize(half + 1);
+        second_sum.resize(half + 1);
+        add_limbs(first_sum.data(), first_sum.size(), first + half, high_first);
+        add_limbs(second_sum.data(), second_sum.size(), second + half, high_second);
+
+        std::vector<limb> middle(2 * half + 2);
+        multiply_limbs(first_sum.data(), first_sum.size(), second_sum.data(), second_sum.size(), middle.data());
+        sub_limbs(middle.data(), middle.size(), low.data(), low.size());
+        sub_limbs(middle.data(), middle.size(), high.data(), high.size());
+
+        while (!middle.empty() && middle.back() == 0) {
+            middle.pop_back();
+        }
+
+        std::fill(result, result + first_size + second_size, 0);
+        std::copy(low.begin(), low.end(), result);
+        std::copy(high.begin(), high.end(), result + 2 * half);
+        add_limbs(result + half, first_size + second_size - half, middle.data(), middle.size());
+    }
+
+    static void multiply_limbs(const limb* first, size_t first_size, const limb* second, size_t second_size, limb* result) {
+        if (first_size < second_size) {
+            std::swap(first, second);
+            std::swap(first_size, second_size);
+        }
+
+        if (second_size < std::max<size_t>(BigIntegerThresholds::karatsuba, 4)) {
+            mul_basecase(first, first_size, second, second_size, result);
+        }
+
+        else if (2 * second_size <= first_size) {
+            std::fill(result, result + first_size + second_size, 0);
+            std::vector<limb> part(2 * second_size);
+
+            for (size_t i = 0; i < first_size; i += second_size) {
+                size_t length = std::min(second_size, first_size - i);
+                multiply_limbs(first + i, length, second, second_size, part.data());
+                add_limbs(result + i, first_size + second_size - i, part.data(), length + second_size);
+            }
         }
 
-        str += '/';
-        str += divisor.toString();
-        return str;
+        else {
+            mul_karatsuba(first, first_size, second, second_size, result);
+        }
     }
 
-    std::string asDecimal(size_t precision = 0) const {
+    static limb divide_small(std::vector<limb>& number, limb divisor) {
+        wide rest = 0;
 
-        std::string str;
+        for (size_t i = number.size(); i > 0; --i) {
+            wide value = (rest << bits_) | number[i - 1];
+            number[i - 1] = static_cast<limb>(value / divisor);
+            rest = value % divisor;
+        }
 
-        if (divisor == 1) {
-            str += dividend.toString();
-            return str;
+        while (number.size() > 1 && number.back() == 0) {
+            number.pop_back();
         }
 
-        if (!static_cast<bool>(dividend.sign_)) {
-            str += '-';
+        return static_cast<limb>(rest);
+    }
+
+    static void divide_limbs(const std::vector<limb>& first, const std::vector<limb>& second,
+                             std::vector<limb>& quotient, std::vector<limb>& remainder) {
+        size_t size = second.size();
+        quotient.assign(first.size() - size + 1, 0);
+
+        if (size == 1) {
+            quotient = first;
+            remainder.assign(1, divide_small(quotient, second[0]));
+            return;
+        }
+
+        int shift = std::countl_zero(second.back());
+        std::vector<limb> divisor(size);
+        std::vector<limb> dividend(first.size() + 1);
+
+        for (size_t i = size; i > 0; --i) {
+            divisor[i - 1] = second[i - 1] << shift;
+
+            if (shift != 0 && i > 1) {
+                divisor[i - 1] |= second[i - 2] >> (bits_ - shift);
+            }
+        }
+
+        for (size_t i = first.size(); i > 0; --i) {
+            dividend[i] |= shift != 0 ? first[i - 1] >> (bits_ - shift) : 0;
+            dividend[i - 1] = first[i - 1] << shift;
+        }
+
+        for (size_t j = first.size() - size + 1; j > 0; --j) {
+            limb* window = dividend.data() + j - 1;
+            wide number = (static_cast<wide>(window[size]) << bits_) | window[size - 1];
+            wide estimate = number / divisor[size - 1];
+            wide rest = number % divisor[size - 1];
+
+            while ((estimate >> bits_) != 0 ||
+                   estimate * divisor[size - 2] > ((rest << bits_) | window[size - 2])) {
+                --estimate;
+                rest += divisor[size - 1];
+
+                if ((rest >> bits_) != 0) {
+                    break;
+                }
+            }
+
+            limb borrow = 0;
+            limb carry = 0;
+
+            for (size_t i = 0; i < size; ++i) {
+                wide product = estimate * divisor[i] + carry;
+                carry = static_cast<limb>(product >> bits_);
+                limb low = static_cast<limb>(product);
+                limb difference = window[i] - low - borrow;
+                borrow = (window[i] < low || window[i] - low < borrow) ? 1 : 0;
+                window[i] = difference;
+            }
+
+            bool negative = window[size] < carry || window[size] - carry < borrow;
+            window[size] -= carry + borrow;
+
+            if (negative) {
+                --estimate;
+                window[size] += add_limbs(window, size, divisor.data(), size);
+            }
+
+            quotient[j - 1] = static_cast<limb>(estimate);
+        }
+
+        remainder.assign(size, 0);
+
+        for (size_t i = 0; i < size; ++i) {
+            remainder[i] = dividend[i] >> shift;
+
+            if (shift != 0) {
+                remainder[i] |= dividend[i + 1] << (bits_ - shift);
+            }
         }
 
-        BigInteger posivite_dividend = dividend;
-        posivite_dividend.sign_ = Sign::positive;
-        BigInteger temp_devidend = posivite_dividend % divisor;
-        BigInteger temp_result = posivite_dividend / divisor;
-        str += temp_result.toString();
-        int len_int = str.size();
+        while (quotient.size() > 1 && quotient.back() == 0) {
+            quotient.pop_back();
+        }
 
-        if (str[0] == '-') {
-            --len_int;
+        while (remainder.size() > 1 && remainder.back() == 0) {
+            remainder.pop_back();
         }
+    }
 
-        str += '.';
-        temp_devidend *= 10;
-        temp_result = temp_devidend;
+    void add(const BinaryBigInteger& other, bool subtract) {
+        Sign other_sign = subtract == static_cast<bool>(other.sign_) ? Sign::negative : Sign::positive;
 
-        while (str.size() < precision + len_int + 2) {
-            temp_result /= divisor;
-            str += temp_result.toString();
-            temp_devidend %= divisor;
-            temp_devidend *= 10;
-            temp_result = temp_devidend;
+        if (sign_ == other_sign) {
+            arr_.resize(std::max(arr_.size(), other.arr_.size()) + 1);
+            add_limbs(arr_.data(), arr_.size(), other.arr_.data(), other.arr_.size());
         }
 
-        if (str[0] == '-' && str.size() > len_int + precision + 2) {
-            str.resize(precision + len_int + 1);
+        else if (compare_limbs(arr_, other.arr_) >= 0) {
+            sub_limbs(arr_.data(), arr_.size(), other.arr_.data(), other.arr_.size());
         }
 
-        else if (str[0] != '-' && str.size() > precision + len_int + 1) {
-            str.resize(precision + len_int + 1);
+        else {
+            std::vector<limb> result = other.arr_;
+            sub_limbs(result.data(), result.size(), arr_.data(), arr_.size());
+            arr_ = std::move(result);
+            sign_ = other_sign;
         }
 
-        return str;
+        clear_zero();
     }
 
-    explicit operator double() const {
-        double result = std::stod(asDecimal(decimal_const));
+    void divide(const BinaryBigInteger& other, bool keep_remainder) {
+        if (compare_limbs(arr_, other.arr_) < 0) {
+
+            if (!keep_remainder) {
+                *this = 0;
+            }
+
+            return;
+        }
+
+        std::vector<limb> quotient;
+        std::vector<limb> remainder;
+        divide_limbs(arr_, other.arr_, quotient, remainder);
+
+        if (keep_remainder) {
+            arr_ = std::move(remainder);
+        }
+
+        else {
+            arr_ = std::move(quotient);
+            sign_ = sign_ == other.sign_ ? Sign::positive : Sign::negative;
+        }
+
+        clear_zero();
+    }
+
+    std::vector<limb> twos_complement(size_t size) const {
+        std::vector<limb> result(arr_);
+        result.resize(size);
+
+        if (!static_cast<bool>(sign_)) {
+
+            for (limb& value : result) {
+                value = ~value;
+            }
+
+            limb one = 1;
+            add_limbs(result.data(), result.size(), &one, 1);
+        }
+
         return result;
     }
 
-    ~Rational() = default;
+    template <typename Operation>
+    BinaryBigInteger& bitwise(const BinaryBigInteger& other, Operation operation) {
+        size_t size = std::max(arr_.size(), other.arr_.size()) + 1;
+        std::vector<limb> first = twos_complement(size);
+        std::vector<limb> second = other.twos_complement(size);
+
+        for (size_t i = 0; i < size; ++i) {
+            first[i] = operation(first[i], second[i]);
+        }
+
+        sign_ = (first.back() >> (bits_ - 1)) != 0 ? Sign::negative : Sign::positive;
+        arr_ = std::move(first);
+
+        if (!static_cast<bool>(sign_)) {
+            arr_ = twos_complement(size);
+        }
+
+        clear_zero();
+        return *this;
+    }
+
+    static const BinaryBigInteger& decimal_power(size_t level) {
+        thread_local std::vector<BinaryBigInteger> powers;
+
+        if (powers.empty()) {
+            powers.push_back(BinaryBigInteger(decimal_base_));
+        }
+
+        while (powers.size() <= level) {
+            BinaryBigInteger square = powers.back();
+            square *= powers.back();
+            powers.push_back(std::move(square));
+        }
+
+        return powers[level];
+    }
+
+    static void write_decimal(BinaryBigInteger number, size_t width, std::string& str) {
+        if (number.arr_.size() <= std::max<size_t>(BigIntegerThresholds::radix_conversion, 1)) {
+            std::vector<limb> chunks;
+
+            while (number.arr_.size() > 1 || number.arr_[0] != 0) {
+                chunks.push_back(divide_small(number.arr_, decimal_base_));
+            }
+
+            char buffer[decimal_digits_];
+            size_t length = 0;
+
+            if (!chunks.empty()) {
+                length = std::to_chars(buffer, buffer + decimal_digits_, chunks.back()).ptr - buffer;
+                length += (chunks.size() - 1) * decimal_digits_;
+            }
+
+            if (width > length) {
+                str.append(width - length, '0');
+            }
+
+            for (size_t i = chunks.size(); i > 0; --i) {
+                char* end = std::to_chars(buffer, buffer + decimal_digits_, chunks[i - 1]).ptr;
+
+                if (i != chunks.size()) {
+                    str.append(decimal_digits_ - (end - buffer), '0');
+                }
+
+                str.append(buffer, end);
+            }
+
+            return;
+        }
+
+        size_t level = 0;
+
+        while (decimal_power(level + 1).arr_.size() * 2 <= number.arr_.size() + 1) {
+            ++level;
+        }
+
+        size_t digits = static_cast<size_t>(decimal_digits_) << level;
+        BinaryBigInteger high = number;
+        high /= decimal_power(level);
+        BinaryBigInteger product = high;
+        product *= decimal_power(level);
+        number -= product;
+        write_decimal(std::move(high), width > digits ? width - digits : 0, str);
+        write_decimal(std::move(number), digits, str);
+    }
+
+    static BinaryBigInteger parse_decimal(const char* first, const char* last) {
+        size_t size = last - first;
+
+        if (size <= decimal_digits_ * std::max<size_t>(BigIntegerThresholds::radix_conversion, 1)) {
+            BinaryBigInteger result = 0;
+            size_t chunk = size % decimal_digits_ == 0 ? decimal_digits_ : size % decimal_digits_;
+
+            for (; first != last; chunk = decimal_digits_) {
+                limb value = 0;
+                std::from_chars(first, first + chunk, value);
+                first += chunk;
+                limb factor = 1;
+
+                for (size_t i = 0; i < chunk; ++i) {
+                    factor *= 10;
+                }
+
+                result.arr_.push_back(0);
+                limb carry = value;
+
+                for (limb& digit : result.arr_) {
+                    wide product = static_cast<wide>(digit) * factor + carry;
+                    digit = static_cast<limb>(product);
+                    carry = static_cast<limb>(product >> bits_);
+                }
+
+                result.clear_zero();
+            }
+
+            return result;
+        }
+
+        size_t level = 0;
+
+        while (static_cast<size_t>(decimal_digits_) << (level + 1) < size) {
+            ++level;
+        }
+
+        size_t digits = static_cast<size_t>(decimal_digits_) << level;
+        BinaryBigInteger result = parse_decimal(first, last - digits);
+        result *= decimal_power(level);
+        result += parse_decimal(last - digits, last);
+        return result;
+    }
+
+public:
+
+    BinaryBigInteger() : BinaryBigInteger(0) {}
+
+    explicit BinaryBigInteger(long long unsigned number) : sign_(Sign::positive), arr_(1, number) {}
+
+    BinaryBigInteger(int integer) : sign_(integer >= 0 ? Sign::positive : Sign::negative),
+                                    arr_(1, integer >= 0 ? integer : -static_cast<long long>(integer)) {}
+
+    explicit BinaryBigInteger(const BigInteger& number) {
+        std::string str = number.toString();
+        bool negative = str[0] == '-';
+        *this = parse_decimal(str.data() + (negative ? 1 : 0), str.data() + str.size());
+        sign_ = negative ? Sign::negative : Sign::positive;
+        clear_zero();
+    }
+
+    explicit operator BigInteger() const {
+        std::string str = toString();
+        BigInteger result;
+        from_chars(str.data(), str.data() + str.size(), result);
+        return result;
+    }
+
+    BinaryBigInteger& operator+=(const BinaryBigInteger& other) {
+        add(other, false);
+        return *this;
+    }
+
+    BinaryBigInteger& operator-=(const BinaryBigInteger& other) {
+        add(other, true);
+        return *this;
+    }
+
+    BinaryBigInteger& operator*=(const BinaryBigInteger& other) {
+        std::vector<limb> result(arr_.size() + other.arr_.size());
+        multiply_limbs(arr_.data(), arr_.size(), other.arr_.data(), other.arr_.size(), result.data());
+        arr_ = std::move(result);
+        sign_ = sign_ == other.sign_ ? Sign::positive : Sign::negative;
+        clear_zero();
+        return *this;
+    }
+
+    BinaryBigInteger& operator/=(const BinaryBigInteger& other) {
+        divide(other, false);
+        return *this;
+    }
+
+    BinaryBigInteger& operator%=(const BinaryBigInteger& other) {
+        divide(other, true);
+        return *this;
+    }
+
+    BinaryBigInteger& operator<<=(size_t shift) {
+        size_t limbs = shift / bits_;
+        int bits = shift % bits_;
+
+        if (bits != 0) {
+            arr_.push_back(0);
+
+            for (size_t i = arr_.size() - 1; i > 0; --i) {
+                arr_[i] = (arr_[i] << bits) | (arr_[i - 1] >> (bits_ - bits));
+            }
+
+            arr_[0] <<= bits;
+        }
+
+        arr_.insert(arr_.begin(), limbs, 0);
+        clear_zero();
+        return *this;
+    }
+
+    BinaryBigInteger& operator>>=(size_t shift) {
+        size_t limbs = shift / bits_;
+        int bits = shift % bits_;
+        bool inexact = false;
+
+        for (size_t i = 0; i < std::min(limbs, arr_.size()); ++i) {
+            inexact = inexact || arr_[i] != 0;
+        }
+
+        if (limbs >= arr_.size()) {
+            arr_.assign(1, 0);
+        }
+
+        else {
+            arr_.erase(arr_.begin(), arr_.begin() + limbs);
+        }
+
+        if (bits != 0) {
+            inexact = inexact || (arr_[0] << (bits_ - bits)) != 0;
+
+            for (size_t i = 0; i + 1 < arr_.size(); ++i) {
+                arr_[i] = (arr_[i] >> bits) | (arr_[i + 1] << (bits_ - bits));
+            }
+
+            arr_.back() >>= bits;
+        }
+
+        if (!static_cast<bool>(sign_) && inexact) {
+            limb one = 1;
+            arr_.push_back(0);
+            add_limbs(arr_.data(), arr_.size(), &one, 1);
+        }
+
+        clear_zero();
+        return *this;
+    }
+
+    BinaryBigInteger& operator&=(const BinaryBigInteger& other) {
+        return bitwise(other, [](limb first, limb second) { return first & second; });
+    }
+
+    BinaryBigInteger& operator|=(const BinaryBigInteger& other) {
+        return bitwise(other, [](limb first, limb second) { return first | second; });
+    }
+
+    BinaryBigInteger& operator^=(const BinaryBigInteger& other) {
+        return bitwise(other, [](limb first, limb second) { return first ^ second; });
+    }
+
+    BinaryBigInteger operator-() const {
+        BinaryBigInteger result = *this;
+        result.sign_ = static_cast<bool>(sign_) ? Sign::negative : Sign::positive;
+        result.clear_zero();
+        return result;
+    }
+
+    BinaryBigInteger& operator++() {
+        return *this += 1;
+    }
+
+    BinaryBigInteger operator++(int) {
+        BinaryBigInteger result = *this;
+        ++(*this);
+        return result;
+    }
+
+    BinaryBigInteger& operator--() {
+        return *this -= 1;
+    }
+
+    BinaryBigInteger operator--(int) {
+        BinaryBigInteger result = *this;
+        --(*this);
+        return result;
+    }
+
+    explicit operator bool() const { return arr_.back() != 0; }
+
+    size_t bit_length() const {
+        return (arr_.size() - 1) * bits_ + bits_ - std::countl_zero(arr_.back());
+    }
+
+    std::string toString() const {
+        std::string str;
+
+        if (!static_cast<bool>(sign_)) {
+            str += '-';
+        }
+
+        BinaryBigInteger magnitude = *this;
+        magnitude.sign_ = Sign::positive;
+        write_decimal(std::move(magnitude), 1, str);
+        return str;
+    }
+
+    std::weak_ordering operator<=>(const BinaryBigInteger& other) const {
+        if (sign_ != other.sign_) {
+            return sign_ <=> other.sign_;
+        }
+
+        return static_cast<bool>(sign_) ? compare_limbs(arr_, other.arr_) : compare_limbs(other.arr_, arr_);
+    }
+
+    bool operator==(const BinaryBigInteger& other) const {
+        return sign_ == other.sign_ && arr_ == other.arr_;
+    }
+
+    ~BinaryBigInteger() = default;
 };
 
-Rational operator+(const Rational& first, const Rational& second) {
-    Rational result = first;
+BinaryBigInteger operator+(const BinaryBigInteger& first, const BinaryBigInteger& second) {
+    BinaryBigInteger result = first;
     result += second;
     return result;
 }
 
-Rational operator-(const Rational& first, const Rational& second) {
-    Rational result = first;
+BinaryBigInteger operator-(const BinaryBigInteger& first, const BinaryBigInteger& second) {
+    BinaryBigInteger result = first;
     result -= second;
     return result;
 }
 
-Rational operator*(const Rational& first, const Rational& second) {
-    Rational result = first;
+BinaryBigInteger operator*(const BinaryBigInteger& first, const BinaryBigInteger& second) {
+    BinaryBigInteger result = first;
     result *= second;
     return result;
 }
 
-Rational operator/(const Rational& first, const Rational& second) {
-    Rational result = first;
+BinaryBigInteger operator/(const BinaryBigInteger& first, const BinaryBigInteger& second) {
+    BinaryBigInteger result = first;
     result /= second;
     return result;
 }
+
+BinaryBigInteger operator%(const BinaryBigInteger& first, const BinaryBigInteger& second) {
+    BinaryBigInteger result = first;
+    result %= second;
+    return result;
+}
+
+BinaryBigInteger operator&(const BinaryBigInteger& first, const BinaryBigInteger& second) {
+    BinaryBigInteger result = first;
+    result &= second;
+    return result;
+}
+
+BinaryBigInteger operator|(const BinaryBigInteger& first, const BinaryBigInteger& second) {
+    BinaryBigInteger result = first;
+    result |= second;
+    return result;
+}
+
+BinaryBigInteger operator^(const BinaryBigInteger& first, const BinaryBigInteger& second) {
+    BinaryBigInteger result = first;
+    result ^= second;
+    return result;
+}
+
+BinaryBigInteger operator<<(BinaryBigInteger number, size_t shift) {
+    number <<= shift;
+    return number;
+}
+
+BinaryBigInteger operator>>(BinaryBigInteger number, size_t shift) {
+    number >>= shift;
+    return number;
+}
+
+std::ostream& operator<<(std::ostream& out, const BinaryBigInteger& number) {
+    out << number.toString();
+    return out;
+}
+
+std::istream& operator>>(std::istream& in, BinaryBigInteger& number) {
+    std::string str;
+    in >> str;
+    bool negative = !str.empty() && str[0] == '-';
+    const char* first = str.data() + (negative ? 1 : 0);
+    const char* last = first;
+
+    while (last != str.data() + str.size() && *last >= '0' && *last <= '9') {
+        ++last;
+    }
+
+    if (first == last || last != str.data() + str.size()) {
+        in.setstate(std::ios::failbit);
+        return in;
+    }
+
+    number = BinaryBigInteger::parse_decimal(first, last);
+    number.sign_ = negative ? Sign::negative : Sign::positive;
+    number.clear_zero();
+    return in;
+}
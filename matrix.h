@@ -3,6 +3,7 @@
 #define CPP23 1
 
 
+#include <algorithm>
 #include <compare>
 #include <string>
 #include <vector>
@@ -16,6 +17,12 @@ enum class Sign{
 };
 
 
+struct BigIntegerThresholds {
+    static inline size_t karatsuba = 48;
+    static inline size_t toom3 = 150;
+};
+
+
 class BigInteger {
 private:
     static const int base_ = 1e9;
@@ -35,6 +42,210 @@ private:
         }
     }
 
+    static void mul_basecase(const long long* first, size_t first_size, const long long* second, size_t second_size, long long* result) {
+        std::fill(result, result + first_size + second_size, 0);
+
+        for (size_t i = 0; i < first_size; ++i) {
+
+            if (first[i] == 0) {
+                continue;
+            }
+
+            unsigned long long carry = 0;
+
+            for (size_t j = 0; j < second_size; ++j) {
+                unsigned long long number = result[i + j];
+                number += static_cast<unsigned long long>(first[i]) * second[j] + carry;
+                result[i + j] = number % base_;
+                carry = number / base_;
+            }
+
+            result[i + second_size] = carry;
+        }
+    }
+
+    static void add_limbs(long long* first, size_t first_size, const long long* second, size_t second_size) {
+        while (second_size > 0 && second[second_size - 1] == 0) {
+            --second_size;
+        }
+
+        int carry = 0;
+
+        for (size_t i = 0; i < first_size && (i < second_size || carry != 0); ++i) {
+            first[i] += (i < second_size ? second[i] : 0) + carry;
+            carry = first[i] >= base_ ? 1 : 0;
+
+            if (carry != 0) {
+                first[i] -= base_;
+            }
+        }
+    }
+
+    static void submul_limbs(long long* first, size_t first_size, const long long* second, size_t second_size, int factor) {
+        long long borrow = 0;
+
+        for (size_t i = 0; i < first_size && (i < second_size || borrow != 0); ++i) {
+            long long number = first[i] - borrow;
+
+            if (i < second_size) {
+                number -= static_cast<long long>(factor) * second[i];
+            }
+
+            borrow = 0;
+
+            if (number < 0) {
+                borrow = (base_ - 1 - number) / base_;
+                number += borrow * base_;
+            }
+
+            first[i] = number;
+        }
+    }
+
+    static void divide_limbs_exact(long long* first, size_t first_size, int divisor) {
+        long long rest = 0;
+
+        for (size_t i = first_size; i > 0; --i) {
+            long long number = rest * base_ + first[i - 1];
+            first[i - 1] = number / divisor;
+            rest = number % divisor;
+        }
+    }
+
+    static void multiply_unbalanced(const long long* first, size_t first_size, const long long* second, size_t second_size, long long* result) {
+        std::fill(result, result + first_size + second_size, 0);
+        std::vector<long long> part(2 * second_size);
+
+        for (size_t i = 0; i < first_size; i += second_size) {
+            size_t length = std::min(second_size, first_size - i);
+            multiply_limbs(first + i, length, second, second_size, part.data());
+            add_limbs(result + i, first_size + second_size - i, part.data(), length + second_size);
+        }
+    }
+
+    static void mul_karatsuba(const long long* first, size_t first_size, const long long* second, size_t second_size, long long* result) {
+        size_t half = (first_size + 1) / 2;
+        size_t high_first = first_size - half;
+        size_t high_second = second_size > half ? second_size - half : 0;
+        size_t low_second = second_size - high_second;
+
+        std::vector<long long> low(2 * half);
+        std::vector<long long> high(high_first + high_second);
+        multiply_limbs(first, half, second, low_second, low.data());
+        multiply_limbs(first + half, high_first, second + half, high_second, high.data());
+
+        std::vector<long long> first_sum(first, first + half);
+        std::vector<long long> second_sum(second, second + low_second);
+        first_sum.resize(half + 1);
+        second_sum.resize(half + 1);
+        add_limbs(first_sum.data(), first_sum.size(), first + half, high_first);
+        add_limbs(second_sum.data(), second_sum.size(), second + half, high_second);
+
+        std::vector<long long> middle(2 * half + 2);
+        multiply_limbs(first_sum.data(), first_sum.size(), second_sum.data(), second_sum.size(), middle.data());
+        submul_limbs(middle.data(), middle.size(), low.data(), low.size(), 1);
+        submul_limbs(middle.data(), middle.size(), high.data(), high.size(), 1);
+
+        std::fill(result, result + first_size + second_size, 0);
+        std::copy(low.begin(), low.end(), result);
+        std::copy(high.begin(), high.end(), result + 2 * half);
+        add_limbs(result + half, first_size + second_size - half, middle.data(), middle.size());
+    }
+
+    static std::vector<long long> toom_evaluate(const long long* number, size_t size, size_t part, int point) {
+        std::vector<long long> value(part + 1);
+        long long carry = 0;
+
+        for (size_t i = 0; i < part; ++i) {
+            long long limb = carry;
+            long long power = 1;
+
+            for (size_t j = i; j < size; j += part) {
+                limb += power * number[j];
+                power *= point;
+            }
+
+            value[i] = limb % base_;
+            carry = limb / base_;
+        }
+
+        value[part] = carry;
+        return value;
+    }
+
+    static void mul_toom3(const long long* first, size_t first_size, const long long* second, size_t second_size, long long* result) {
+        size_t part = (first_size + 2) / 3;
+        std::vector<long long> first_parts(3 * part);
+        std::vector<long long> second_parts(3 * part);
+        std::copy(first, first + first_size, first_parts.begin());
+        std::copy(second, second + second_size, second_parts.begin());
+
+        std::vector<long long> values[5];
+        values[0].resize(2 * part);
+        multiply_limbs(first_parts.data(), part, second_parts.data(), part, values[0].data());
+        values[4].resize(2 * part);
+        multiply_limbs(first_parts.data() + 2 * part, part, second_parts.data() + 2 * part, part, values[4].data());
+
+        for (int point = 1; point <= 3; ++point) {
+            std::vector<long long> first_value = toom_evaluate(first_parts.data(), first_parts.size(), part, point);
+            std::vector<long long> second_value = toom_evaluate(second_parts.data(), second_parts.size(), part, point);
+            values[point].resize(2 * part + 2);
+            multiply_limbs(first_value.data(), part + 1, second_value.data(), part + 1, values[point].data());
+        }
+
+        for (int point = 1; point <= 3; ++point) {
+            submul_limbs(values[point].data(), values[point].size(), values[0].data(), values[0].size(), 1);
+            submul_limbs(values[point].data(), values[point].size(), values[4].data(), values[4].size(),
+                         point * point * point * point);
+        }
+
+        divide_limbs_exact(values[2].data(), values[2].size(), 2);
+        divide_limbs_exact(values[3].data(), values[3].size(), 3);
+        submul_limbs(values[3].data(), values[3].size(), values[2].data(), values[2].size(), 1);
+        submul_limbs(values[2].data(), values[2].size(), values[1].data(), values[1].size(), 1);
+        submul_limbs(values[3].data(), values[3].size(), values[2].data(), values[2].size(), 1);
+        divide_limbs_exact(values[3].data(), values[3].size(), 2);
+        submul_limbs(values[2].data(), values[2].size(), values[3].data(), values[3].size(), 3);
+        submul_limbs(values[1].data(), values[1].size(), values[2].data(), values[2].size(), 1);
+        submul_limbs(values[1].data(), values[1].size(), values[3].data(), values[3].size(), 1);
+
+        std::fill(result, result + first_size + second_size, 0);
+
+        for (size_t i = 0; i < 5; ++i) {
+            size_t shift = i * part;
+
+            if (shift < first_size + second_size) {
+                add_limbs(result + shift, first_size + second_size - shift, values[i].data(), values[i].size());
+            }
+        }
+    }
+
+    static void multiply_limbs(const long long* first, size_t first_size, const long long* second, size_t second_size, long long* result) {
+        if (first_size < second_size) {
+            std::swap(first, second);
+            std::swap(first_size, second_size);
+        }
+
+        size_t karatsuba = std::max<size_t>(BigIntegerThresholds::karatsuba, 4);
+        size_t toom3 = std::max(BigIntegerThresholds::toom3, karatsuba);
+
+        if (second_size < karatsuba) {
+            mul_basecase(first, first_size, second, second_size, result);
+        }
+
+        else if (2 * second_size <= first_size) {
+            multiply_unbalanced(first, first_size, second, second_size, result);
+        }
+
+        else if (second_size < toom3 || 3 * second_size <= 2 * first_size) {
+            mul_karatsuba(first, first_size, second, second_size, result);
+        }
+
+        else {
+            mul_toom3(first, first_size, second, second_size, result);
+        }
+    }
+
 public:
 
     BigInteger() : BigInteger(0){}
@@ -142,35 +353,9 @@ public:
     BigInteger& operator*=(const BigInteger& other) {
 
         sign_ = (static_cast<bool>(sign_) == static_cast<bool>(other.sign_)) ? Sign::positive : Sign::negative;
-        long long number = 1;
         std::vector<long long> new_arr(arr_.size() + other.arr_.size() + 1);
-
-        for (size_t i = 0; i < arr_.size(); ++i) {
-
-            for (size_t j = 0; j < other.arr_.size(); ++j) {
-                number = arr_[i];
-                number *= other.arr_[j];
-                new_arr[i + j] += (number % base_);
-                new_arr[i + j + 1] += (number / base_);
-                number = 1;
-            }
-
-        }
-
-        arr_.resize(new_arr.size());
-
-        for (size_t i = 0; i < arr_.size(); ++i) {
-
-            if (new_arr[i] >= base_) {
-                new_arr[i + 1] += new_arr[i] / base_;
-                arr_[i] = (new_arr[i] % base_);
-            }
-
-            else {
-                arr_[i] = new_arr[i];
-            }
-
-        }
+        multiply_limbs(arr_.data(), arr_.size(), other.arr_.data(), other.arr_.size(), new_arr.data());
+        arr_ = std::move(new_arr);
 
         clear_zero();
 